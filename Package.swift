@@ -11,6 +11,10 @@ let package = Package(
         .library(
             name: "Novin",
             targets: ["Novin"]
+        ),
+        .executable(
+            name: "NovinBenchmarks",
+            targets: ["NovinBenchmarks"]
         )
     ],
     targets: [
@@ -21,6 +25,16 @@ let package = Package(
             resources: [
                 .process("Rules")
             ]
+        ),
+        .executableTarget(
+            name: "NovinBenchmarks",
+            dependencies: ["Novin"],
+            path: "Sources/NovinBenchmarks"
+        ),
+        .executableTarget(
+            name: "NovinRuleCompiler",
+            dependencies: ["Novin"],
+            path: "Sources/NovinRuleCompiler"
         )
     ]
 )
@@ -0,0 +1,194 @@
+import Foundation
+
+/// Persistent append-only sink for audit trails.
+///
+/// Records are framed as `[UInt32 length][16-byte requestId][JSON payload]`
+/// and appended to a single log file, so 30 days of compliance history lives
+/// on disk instead of in memory. Appends are buffered and flushed in chunks,
+/// making the per-assessment write cost a single in-memory append. Lookups
+/// by requestId go through an offset index rebuilt at open time by walking
+/// only the frame headers (payloads are skipped), and export streams record
+/// payloads straight out of a mapped view of the file without materializing
+/// one giant string.
+@available(iOS 15.0, macOS 12.0, *)
+final class AuditLogStore {
+
+    private let queue = DispatchQueue(label: "com.novinintelligence.auditlog")
+    private let logURL: URL
+    private let encoder: JSONEncoder
+    private let decoder: JSONDecoder
+
+    // Buffered write-behind: frames accumulate here and hit disk in chunks
+    private var writeBuffer = Data()
+    private let flushThresholdBytes = 32 * 1024
+
+    // requestId → byte offset of the frame in the log file (committed frames
+    // only; buffered frames are tracked separately until flushed)
+    private var offsetIndex: [UUID: UInt64] = [:]
+    private var committedSize: UInt64 = 0
+
+    init(directory: URL? = nil) {
+        let base = directory ?? FileManager.default.urls(for: .applicationSupportDirectory, in: .userDomainMask).first!
+            .appendingPathComponent("com.novinintelligence", isDirectory: true)
+        try? FileManager.default.createDirectory(at: base, withIntermediateDirectories: true)
+        self.logURL = base.appendingPathComponent("audit.log")
+
+        let enc = JSONEncoder()
+        enc.dateEncodingStrategy = .iso8601
+        self.encoder = enc
+        let dec = JSONDecoder()
+        dec.dateDecodingStrategy = .iso8601
+        self.decoder = dec
+
+        queue.sync { rebuildIndex() }
+    }
+
+    // MARK: - Write Path
+
+    /// Append one trail; cost is an in-memory buffer append, with disk I/O
+    /// amortized over the flush threshold
+    func append(_ trail: AuditTrail) {
+        queue.async {
+            guard let payload = try? self.encoder.encode(trail) else { return }
+            var frame = Data(capacity: 4 + 16 + payload.count)
+            var length = UInt32(payload.count).littleEndian
+            withUnsafeBytes(of: &length) { frame.append(contentsOf: $0) }
+            withUnsafeBytes(of: trail.requestId.uuid) { frame.append(contentsOf: $0) }
+            frame.append(payload)
+
+            self.offsetIndex[trail.requestId] = self.committedSize + UInt64(self.writeBuffer.count)
+            self.writeBuffer.append(frame)
+            if self.writeBuffer.count >= self.flushThresholdBytes {
+                self.flushLocked()
+            }
+        }
+    }
+
+    /// Force buffered frames to disk (app-background transitions, export)
+    func flush() {
+        queue.sync { flushLocked() }
+    }
+
+    // MARK: - Read Path
+
+    /// Look up a persisted trail by requestId via the offset index.
+    /// Only the snapshot capture runs on the queue; decoding happens off it.
+    func trail(requestId: UUID) -> AuditTrail? {
+        let found: (offset: UInt64, data: Data)? = queue.sync {
+            flushLocked()
+            guard let offset = offsetIndex[requestId],
+                  let data = mappedLog() else { return nil }
+            return (offset, data)
+        }
+        guard let found = found,
+              let payload = payloadAt(offset: Int(found.offset), in: found.data) else { return nil }
+        return try? decoder.decode(AuditTrail.self, from: payload)
+    }
+
+    /// Stream every persisted trail as JSON, emitting one chunk per record
+    /// instead of materializing the whole export. The consumer receives a
+    /// well-formed JSON array across the sequence of chunks.
+    ///
+    /// Snapshot semantics: the queue is held only long enough to flush and
+    /// capture an immutable mapped view of the committed log, bounded at the
+    /// snapshot size. Because the log is append-only, that view never changes
+    /// underneath the reader — string conversion and consumer callbacks run
+    /// entirely off the write path, so a multi-megabyte export proceeds
+    /// concurrently with full-rate appends and neither side blocks the other.
+    func streamExport(_ consume: (String) -> Void) {
+        let snapshot: (data: Data, size: Int)? = queue.sync {
+            flushLocked()
+            guard let data = mappedLog() else { return nil }
+            return (data, Int(committedSize))
+        }
+        guard let snapshot = snapshot, snapshot.size > 0 else {
+            consume("[]")
+            return
+        }
+
+        let data = snapshot.data
+        let end = min(data.count, snapshot.size)
+        consume("[")
+        var offset = 0
+        var first = true
+        while offset + 20 <= end {
+            guard let payload = payloadAt(offset: offset, in: data),
+                  offset + 20 + payload.count <= end else { break }
+            if let json = String(data: payload, encoding: .utf8) {
+                consume(first ? json : ",\n\(json)")
+                first = false
+            }
+            offset += 20 + payload.count
+        }
+        consume("]")
+    }
+
+    /// Number of persisted records (for diagnostics)
+    var persistedCount: Int {
+        return queue.sync { offsetIndex.count }
+    }
+
+    /// Remove the log and index (for testing)
+    func reset() {
+        queue.sync {
+            writeBuffer.removeAll()
+            offsetIndex.removeAll()
+            committedSize = 0
+            try? FileManager.default.removeItem(at: logURL)
+        }
+    }
+
+    // MARK: - Internals (call on queue)
+
+    private func flushLocked() {
+        guard !writeBuffer.isEmpty else { return }
+        if !FileManager.default.fileExists(atPath: logURL.path) {
+            FileManager.default.createFile(atPath: logURL.path, contents: nil)
+        }
+        guard let handle = try? FileHandle(forWritingTo: logURL) else { return }
+        defer { try? handle.close() }
+        do {
+            try handle.seekToEnd()
+            try handle.write(contentsOf: writeBuffer)
+            committedSize += UInt64(writeBuffer.count)
+            writeBuffer.removeAll(keepingCapacity: true)
+        } catch {
+            // Keep the buffer; a later flush retries
+        }
+    }
+
+    /// Mapped read-only view of the committed log
+    private func mappedLog() -> Data? {
+        return try? Data(contentsOf: logURL, options: .alwaysMapped)
+    }
+
+    /// Extract the JSON payload of the frame starting at `offset`
+    private func payloadAt(offset: Int, in data: Data) -> Data? {
+        guard offset + 20 <= data.count else { return nil }
+        let lengthBytes = data.subdata(in: offset..<(offset + 4))
+        let length = Int(UInt32(littleEndian: lengthBytes.withUnsafeBytes { $0.load(as: UInt32.self) }))
+        let payloadStart = offset + 20
+        guard length > 0, payloadStart + length <= data.count else { return nil }
+        return data.subdata(in: payloadStart..<(payloadStart + length))
+    }
+
+    /// Rebuild the requestId → offset index by walking frame headers only
+    private func rebuildIndex() {
+        offsetIndex.removeAll()
+        committedSize = 0
+        guard let data = mappedLog() else { return }
+        var offset = 0
+        while offset + 20 <= data.count {
+            let lengthBytes = data.subdata(in: offset..<(offset + 4))
+            let length = Int(UInt32(littleEndian: lengthBytes.withUnsafeBytes { $0.load(as: UInt32.self) }))
+            guard length > 0, offset + 20 + length <= data.count else { break }
+            let idBytes = data.subdata(in: (offset + 4)..<(offset + 20))
+            let uuid = idBytes.withUnsafeBytes { raw -> UUID in
+                UUID(uuid: raw.load(as: uuid_t.self))
+            }
+            offsetIndex[uuid] = UInt64(offset)
+            offset += 20 + length
+        }
+        committedSize = UInt64(offset)
+    }
+}
@@ -1,6 +1,18 @@
 import Foundation
 import CryptoKit
 
+/// Audit recording detail policy (configure via
+/// `NovinIntelligence.setAuditDetail(_:)`)
+public enum AuditDetailPolicy {
+    /// Full breakdown for every event (default)
+    case full
+    /// Minimal records (id, hash, level, score, time) for low-threat events,
+    /// full breakdown for everything else. `lowThreatFullSampleRate` in [0,1]
+    /// keeps that fraction of low-threat events at full detail so benign
+    /// traffic still leaves a statistically useful trail.
+    case tiered(lowThreatFullSampleRate: Double)
+}
+
 /// Enterprise audit trail for explainability and compliance
 @available(iOS 15.0, macOS 12.0, *)
 public struct AuditTrail: Codable {
@@ -47,6 +59,49 @@ public struct AuditTrail: Codable {
         return String(data: data, encoding: .utf8) ?? "{}"
     }
     
+    /// Minimal-tier record: identity, input hash, and the final decision only.
+    /// Used for low-threat traffic when tiered auditing is enabled — the
+    /// intermediate breakdown is pure overhead on benign events.
+    public static func minimal(
+        requestId: UUID,
+        timestamp: Date,
+        inputHash: String,
+        configVersion: String,
+        sdkMode: String,
+        finalThreatLevel: String,
+        finalScore: Double,
+        confidence: Double,
+        processingTimeMs: Double
+    ) -> AuditTrail {
+        return AuditTrail(
+            requestId: requestId,
+            timestamp: timestamp,
+            inputHash: inputHash,
+            configVersion: configVersion,
+            sdkMode: sdkMode,
+            eventType: nil,
+            eventLocation: nil,
+            intermediateScores: [:],
+            rulesTriggered: [],
+            chainPattern: nil,
+            motionAnalysis: nil,
+            zoneRiskScore: nil,
+            finalThreatLevel: finalThreatLevel,
+            finalScore: finalScore,
+            confidence: confidence,
+            processingTimeMs: processingTimeMs,
+            fusionBreakdown: FusionBreakdown(
+                bayesianScore: 0.0,
+                ruleBasedScore: 0.0,
+                mentalModelAdjustment: 0.0,
+                temporalDampening: 0.0,
+                chainPatternAdjustment: 0.0,
+                finalScore: finalScore
+            ),
+            temporalFactors: [:]
+        )
+    }
+
     /// Create privacy-safe hash of input
     public static func hashInput(_ input: [String: Any]) -> String {
         // Create deterministic string representation
@@ -60,88 +115,106 @@ public struct AuditTrail: Codable {
 }
 
 /// Audit trail manager
+///
+/// Recent trails stay in memory for fast queries; every trail is also
+/// appended to the persistent `AuditLogStore`, so history survives restarts
+/// without holding 30 days of records in RAM. Non-persistent instances keep
+/// trails in memory only — per-site context engines record through their own
+/// in-memory manager so tenant trails never commingle in the process-wide
+/// on-disk log.
 @available(iOS 15.0, macOS 12.0, *)
 public final class AuditTrailManager: @unchecked Sendable {
-    
+
     private let queue = DispatchQueue(label: "com.novinintelligence.audittrail")
     private var trails: [AuditTrail] = []
     private let maxTrailsStored: Int = 1000
-    private let persistenceKey = "com.novinintelligence.audittrails"
-    
-    public static let shared = AuditTrailManager()
-    
-    private init() {
-        loadFromDisk()
+    // nil for in-memory managers; no store is even opened, so a
+    // non-persistent manager never touches disk
+    private let logStore: AuditLogStore?
+
+    public static let shared = AuditTrailManager(persistent: true)
+
+    internal init(persistent: Bool) {
+        self.logStore = persistent ? AuditLogStore() : nil
     }
-    
+
     /// Record audit trail
     public func record(_ trail: AuditTrail) {
         queue.async {
             self.trails.append(trail)
-            
-            // Enforce max size
+
+            // Enforce max in-memory size; older trails remain in the log store
             if self.trails.count > self.maxTrailsStored {
                 self.trails.removeFirst(self.trails.count - self.maxTrailsStored)
             }
-            
-            // Persist to disk
-            self.saveToDisk()
         }
+        // Persistent sink: buffered append, no per-event encode-all pass
+        logStore?.append(trail)
     }
-    
+
     /// Get recent trails
     public func getRecentTrails(limit: Int = 100) -> [AuditTrail] {
         return queue.sync {
             Array(trails.suffix(limit))
         }
     }
-    
-    /// Get trail by request ID
+
+    /// Get trail by request ID (in-memory first, then the persistent index)
     public func getTrail(requestId: UUID) -> AuditTrail? {
-        return queue.sync {
-            trails.first { $0.requestId == requestId }
+        if let trail = queue.sync(execute: { trails.first { $0.requestId == requestId } }) {
+            return trail
         }
+        return logStore?.trail(requestId: requestId)
     }
-    
-    /// Export all trails as JSON
+
+    /// Export all trails as JSON.
+    /// Note: materializes the full export; prefer `streamTrails(_:)` for
+    /// large histories.
     public func exportAllTrails() -> String? {
-        return queue.sync {
+        var out = ""
+        streamTrails { chunk in out += chunk }
+        return out.isEmpty ? nil : out
+    }
+
+    /// Stream all trails as JSON chunks without building one giant string;
+    /// the chunks concatenate to a well-formed JSON array. In-memory managers
+    /// export their retained trails instead of a persisted history.
+    public func streamTrails(_ consume: (String) -> Void) {
+        guard let logStore = logStore else {
+            let snapshot = queue.sync { trails }
             let encoder = JSONEncoder()
             encoder.dateEncodingStrategy = .iso8601
-            encoder.outputFormatting = [.prettyPrinted]
-            guard let data = try? encoder.encode(trails),
-                  let json = String(data: data, encoding: .utf8) else {
-                return nil
+            if let data = try? encoder.encode(snapshot), let json = String(data: data, encoding: .utf8) {
+                consume(json)
             }
-            return json
+            return
         }
+        logStore.streamExport(consume)
     }
-    
+
+    /// Export all trails to a file, writing incrementally
+    public func exportTrails(to url: URL) throws {
+        FileManager.default.createFile(atPath: url.path, contents: nil)
+        let handle = try FileHandle(forWritingTo: url)
+        defer { try? handle.close() }
+        streamTrails { chunk in
+            if let data = chunk.data(using: .utf8) {
+                try? handle.write(contentsOf: data)
+            }
+        }
+    }
+
+    /// Flush buffered audit writes to disk (app-background transitions)
+    public func flush() {
+        logStore?.flush()
+    }
+
     /// Clear all trails
     public func reset() {
         queue.sync {
             trails.removeAll()
-            saveToDisk()
         }
-    }
-    
-    // MARK: - Persistence
-    
-    private func saveToDisk() {
-        let encoder = JSONEncoder()
-        encoder.dateEncodingStrategy = .iso8601
-        
-        guard let data = try? encoder.encode(trails) else { return }
-        UserDefaults.standard.set(data, forKey: persistenceKey)
-    }
-    
-    private func loadFromDisk() {
-        guard let data = UserDefaults.standard.data(forKey: persistenceKey) else { return }
-        
-        let decoder = JSONDecoder()
-        decoder.dateDecodingStrategy = .iso8601
-        
-        trails = (try? decoder.decode([AuditTrail].self, from: data)) ?? []
+        logStore?.reset()
     }
 }
 
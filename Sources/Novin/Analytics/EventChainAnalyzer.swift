@@ -1,26 +1,78 @@
 import Foundation
 
 public final class EventChainAnalyzer: @unchecked Sendable {
-    
+
     // MARK: - Configuration
     private let bufferWindow: TimeInterval = 60  // 60 second window
     private let maxBufferSize: Int = 100
-    
+
     // MARK: - State
+    // Fixed-capacity ring buffer indexed by monotonically increasing sequence
+    // numbers: event with sequence s lives at s % maxBufferSize while it has
+    // not been overwritten. The ring only serves `getRecentEvents`; detection
+    // itself is incremental (see below) and never rescans it.
+    //
+    // Note: since the executor shards one analyzer per location lane, this
+    // queue is effectively uncontended; it remains for external callers
+    // (getRecentEvents) on other threads.
     private let queue = DispatchQueue(label: "com.novinintelligence.eventchain")
-    private var eventBuffer: [SecurityEvent] = []
-    
-    public init() {}
-    
+    private var ring: [SecurityEvent?]
+    private var nextSeq: Int = 0
+
+    // MARK: - Incremental Matching State
+    //
+    // Each chain pattern is a small automaton advanced one step per incoming
+    // event, so detection costs O(patterns) per event instead of re-running
+    // every detector over the whole buffer (O(patterns × buffer)) inside the
+    // serialized section every sensor shares.
+    //
+    // The sequence patterns (delivery, intrusion, break-in) fire off the last
+    // one or two events — the same consecutive pairs/triples the old scans
+    // looked for — and a fired match stays live until its first event ages out
+    // of the window, reproducing how rescans kept re-reporting a pattern for
+    // every later event while its constituents remained in the buffer.
+
+    /// A fired sequence match that keeps reporting until its constituents
+    /// would have left the analysis window
+    private struct LiveMatch {
+        let pattern: ChainPattern
+        let expiry: Date
+    }
+
+    // Last two events in arrival order (the automaton "tape head")
+    private var prevEvent: SecurityEvent?
+    private var prevPrevEvent: SecurityEvent?
+
+    // Sequence matches currently live
+    private var liveIntrusion: LiveMatch?
+    private var liveBreakIn: LiveMatch?
+    // Delivery additionally tracks its motion endpoint so later activity at
+    // the same location can cancel the "silence" premise
+    private var liveDelivery: (match: LiveMatch, location: String, motionTime: Date)?
+
+    // Sliding windows for the count-based detectors. Head index instead of
+    // removeFirst so pruning never shifts elements; compaction is amortized.
+    private var doorWindow: [SecurityEvent] = []
+    private var doorWindowHead: Int = 0
+    private var motionWindow: [SecurityEvent] = []
+    private var motionWindowHead: Int = 0
+    // Distinct-location bookkeeping for the prowler detector, maintained
+    // alongside motionWindow so the distinct count is O(1) per event
+    private var motionLocationCounts: [String: Int] = [:]
+
+    public init() {
+        self.ring = [SecurityEvent?](repeating: nil, count: maxBufferSize)
+    }
+
     // MARK: - Types
-    
+
     public struct SecurityEvent {
         public let type: String
         public let timestamp: Date
         public let location: String
         public let confidence: Double
         public let metadata: [String: Any]
-        
+
         public init(type: String, timestamp: Date, location: String, confidence: Double, metadata: [String: Any] = [:]) {
             self.type = type
             self.timestamp = timestamp
@@ -29,7 +81,7 @@ public final class EventChainAnalyzer: @unchecked Sendable {
             self.metadata = metadata
         }
     }
-    
+
     public struct ChainPattern {
         public let name: String
         public let events: [SecurityEvent]
@@ -37,227 +89,231 @@ public final class EventChainAnalyzer: @unchecked Sendable {
         public let confidence: Double
         public let reasoning: String
     }
-    
+
     // MARK: - Analysis
-    
+
     /// Analyze event chain and detect patterns
     public func analyzeChain(_ newEvent: SecurityEvent) -> ChainPattern? {
         return queue.sync {
-            // Add event to buffer
+            // Add event to ring buffer (for getRecentEvents)
             addToBuffer(newEvent)
-            
-            // Clean old events outside window
-            cleanBuffer()
-            
-            // Detect patterns
-            return detectPatterns()
+
+            // Advance the pattern automata one step
+            return advance(newEvent)
         }
     }
-    
+
+    /// Current live pattern without inserting an event. Lets schedulers ask
+    /// "has a chain started forming?" after parking deferred events, and lets
+    /// coalesced assessments read chain context for events already buffered.
+    public func currentPattern() -> ChainPattern? {
+        return queue.sync { selectLocked(now: Date()) }
+    }
+
     /// Get recent events in buffer
     public func getRecentEvents() -> [SecurityEvent] {
-        return queue.sync { eventBuffer }
+        return queue.sync { liveEvents() }
     }
-    
+
     /// Clear buffer (for testing)
     public func reset() {
         queue.sync {
-            eventBuffer.removeAll()
+            ring = [SecurityEvent?](repeating: nil, count: maxBufferSize)
+            nextSeq = 0
+            prevEvent = nil
+            prevPrevEvent = nil
+            liveDelivery = nil
+            liveIntrusion = nil
+            liveBreakIn = nil
+            doorWindow.removeAll()
+            doorWindowHead = 0
+            motionWindow.removeAll()
+            motionWindowHead = 0
+            motionLocationCounts.removeAll()
         }
     }
-    
-    // MARK: - Private Methods
-    
+
+    // MARK: - Ring Buffer
+
     private func addToBuffer(_ event: SecurityEvent) {
-        eventBuffer.append(event)
-        
-        // Enforce max buffer size
-        if eventBuffer.count > maxBufferSize {
-            eventBuffer.removeFirst(eventBuffer.count - maxBufferSize)
-        }
+        ring[nextSeq % maxBufferSize] = event
+        nextSeq += 1
     }
-    
-    private func cleanBuffer() {
-        let cutoff = Date().addingTimeInterval(-bufferWindow)
-        eventBuffer.removeAll { $0.timestamp < cutoff }
+
+    /// Lowest sequence number still resident in the ring
+    private var oldestLiveSeq: Int {
+        return max(0, nextSeq - maxBufferSize)
     }
-    
-    private func detectPatterns() -> ChainPattern? {
-        // Pattern 1: Doorbell → Motion → Silence = Package Delivery
-        if let deliveryPattern = detectDeliveryPattern() {
-            return deliveryPattern
+
+    /// Live events inside the time window, in arrival order
+    private func liveEvents() -> [SecurityEvent] {
+        let cutoff = Date().addingTimeInterval(-bufferWindow)
+        var out: [SecurityEvent] = []
+        for seq in oldestLiveSeq..<nextSeq {
+            if let e = ring[seq % maxBufferSize], e.timestamp >= cutoff {
+                out.append(e)
+            }
         }
-        
-        // Pattern 2: Motion → Door → Motion = Potential Intrusion
-        if let intrusionPattern = detectIntrusionPattern() {
-            return intrusionPattern
+        return out
+    }
+
+    // MARK: - Incremental Detection
+
+    private func advance(_ event: SecurityEvent) -> ChainPattern? {
+        let now = Date()
+
+        // Any follow-up activity at the delivery location within 20s of the
+        // motion breaks the "silence" premise and cancels the match
+        if let d = liveDelivery,
+           event.location == d.location,
+           event.timestamp > d.motionTime,
+           event.timestamp.timeIntervalSince(d.motionTime) < 20 {
+            liveDelivery = nil
         }
-        
-        // Pattern 3: Multiple Failed Door Attempts = Forced Entry Attempt
-        if let forcedEntryPattern = detectForcedEntryPattern() {
-            return forcedEntryPattern
+
+        let isMotion = event.type.contains("motion")
+        let isDoorOrWindow = event.type.contains("door") || event.type.contains("window")
+
+        // Pattern 1: Doorbell → Motion (same location, 2-30s) = Package Delivery
+        // Fires as soon as the pair forms; silence after is vacuously true and
+        // later activity cancels via the check above.
+        if isMotion, let prev = prevEvent,
+           prev.type.contains("doorbell") || prev.type.contains("chime"),
+           prev.location == event.location {
+            let gap = event.timestamp.timeIntervalSince(prev.timestamp)
+            if gap >= 2 && gap <= 30 {
+                let pattern = ChainPattern(
+                    name: "package_delivery",
+                    events: [prev, event],
+                    threatDelta: -0.4,  // Reduce threat
+                    confidence: 0.85,
+                    reasoning: "Doorbell + quick motion + silence = likely package delivery"
+                )
+                liveDelivery = (
+                    match: LiveMatch(pattern: pattern, expiry: prev.timestamp.addingTimeInterval(bufferWindow)),
+                    location: event.location,
+                    motionTime: event.timestamp
+                )
+            }
         }
-        
-        // Pattern 4: Glass Break → Motion = Active Break-In
-        if let breakInPattern = detectBreakInPattern() {
-            return breakInPattern
+
+        // Pattern 2: Motion → Door → Motion (each gap ≤30s) = Potential Intrusion
+        if isMotion, let prev = prevEvent, let prevPrev = prevPrevEvent,
+           prevPrev.type.contains("motion"),
+           prev.type.contains("door") || prev.type.contains("window") {
+            let time12 = prev.timestamp.timeIntervalSince(prevPrev.timestamp)
+            let time23 = event.timestamp.timeIntervalSince(prev.timestamp)
+            if time12 <= 30 && time23 <= 30 {
+                let pattern = ChainPattern(
+                    name: "intrusion_sequence",
+                    events: [prevPrev, prev, event],
+                    threatDelta: 0.5,  // Increase threat
+                    confidence: 0.90,
+                    reasoning: "Motion + door/window + continued motion = intrusion pattern"
+                )
+                liveIntrusion = LiveMatch(pattern: pattern, expiry: prevPrev.timestamp.addingTimeInterval(bufferWindow))
+            }
         }
-        
-        // Pattern 5: Repeated Motion in Multiple Zones = Prowler
-        if let prowlerPattern = detectProwlerPattern() {
-            return prowlerPattern
+
+        // Pattern 4: Glass Break → Motion (≤20s) = Active Break-In
+        if isMotion, let prev = prevEvent, prev.type.contains("glass"),
+           event.timestamp.timeIntervalSince(prev.timestamp) <= 20 {
+            let pattern = ChainPattern(
+                name: "active_break_in",
+                events: [prev, event],
+                threatDelta: 0.7,  // Critical threat increase
+                confidence: 0.95,
+                reasoning: "Glass break + motion = active break-in in progress"
+            )
+            liveBreakIn = LiveMatch(pattern: pattern, expiry: prev.timestamp.addingTimeInterval(bufferWindow))
         }
-        
-        return nil
-    }
-    
-    // MARK: - Pattern Detection
-    
-    /// Detect: Doorbell → Motion → Silence (10-30s) = Package Delivery
-    private func detectDeliveryPattern() -> ChainPattern? {
-        guard eventBuffer.count >= 2 else { return nil }
-        
-        // Look for doorbell followed by motion, then silence
-        for i in 0..<(eventBuffer.count - 1) {
-            let event1 = eventBuffer[i]
-            let event2 = eventBuffer[i + 1]
-            
-            // Doorbell → Motion at same location
-            if (event1.type.contains("doorbell") || event1.type.contains("chime")) &&
-               event2.type.contains("motion") &&
-               event1.location == event2.location {
-                
-                let timeDiff = event2.timestamp.timeIntervalSince(event1.timestamp)
-                
-                // 2-30 second gap is typical for package drop
-                if timeDiff >= 2 && timeDiff <= 30 {
-                    // Check for silence after (no more events at this location)
-                    let hasSubsequentActivity = eventBuffer.suffix(from: i + 2).contains { event in
-                        event.location == event1.location && event.timestamp.timeIntervalSince(event2.timestamp) < 20
-                    }
-                    
-                    if !hasSubsequentActivity {
-                        return ChainPattern(
-                            name: "package_delivery",
-                            events: [event1, event2],
-                            threatDelta: -0.4,  // Reduce threat
-                            confidence: 0.85,
-                            reasoning: "Doorbell + quick motion + silence = likely package delivery"
-                        )
-                    }
-                }
-            }
+
+        // Count windows for the frequency detectors
+        if isDoorOrWindow {
+            doorWindow.append(event)
         }
-        
-        return nil
-    }
-    
-    /// Detect: Motion → Door → Motion (continuing) = Potential Intrusion
-    private func detectIntrusionPattern() -> ChainPattern? {
-        guard eventBuffer.count >= 3 else { return nil }
-        
-        for i in 0..<(eventBuffer.count - 2) {
-            let event1 = eventBuffer[i]
-            let event2 = eventBuffer[i + 1]
-            let event3 = eventBuffer[i + 2]
-            
-            // Motion → Door → Motion (continuing activity)
-            if event1.type.contains("motion") &&
-               (event2.type.contains("door") || event2.type.contains("window")) &&
-               event3.type.contains("motion") {
-                
-                let time12 = event2.timestamp.timeIntervalSince(event1.timestamp)
-                let time23 = event3.timestamp.timeIntervalSince(event2.timestamp)
-                
-                // Events within 30 seconds
-                if time12 <= 30 && time23 <= 30 {
-                    return ChainPattern(
-                        name: "intrusion_sequence",
-                        events: [event1, event2, event3],
-                        threatDelta: 0.5,  // Increase threat
-                        confidence: 0.90,
-                        reasoning: "Motion + door/window + continued motion = intrusion pattern"
-                    )
-                }
-            }
+        if isMotion {
+            motionWindow.append(event)
+            motionLocationCounts[event.location, default: 0] += 1
         }
-        
-        return nil
+        prevPrevEvent = prevEvent
+        prevEvent = event
+
+        return selectLocked(now: now)
     }
-    
-    /// Detect: Multiple door/window events in short time = Forced Entry
-    private func detectForcedEntryPattern() -> ChainPattern? {
-        let last15Seconds = Date().addingTimeInterval(-15)
-        let recentDoorEvents = eventBuffer.filter { event in
-            (event.type.contains("door") || event.type.contains("window")) &&
-            event.timestamp >= last15Seconds
-        }
-        
-        // 3+ door/window events in 15 seconds = forced entry attempt
-        if recentDoorEvents.count >= 3 {
+
+    /// Expire stale matches, prune the count windows, and report the
+    /// highest-priority live pattern. Call on the queue.
+    private func selectLocked(now: Date) -> ChainPattern? {
+        // Expire sequence matches whose first event has left the window
+        if let d = liveDelivery, now > d.match.expiry { liveDelivery = nil }
+        if let i = liveIntrusion, now > i.expiry { liveIntrusion = nil }
+        if let b = liveBreakIn, now > b.expiry { liveBreakIn = nil }
+
+        pruneDoorWindow(before: now.addingTimeInterval(-15))
+        pruneMotionWindow(before: now.addingTimeInterval(-bufferWindow))
+
+        // Report in the same priority order the sequential detectors ran
+        if let d = liveDelivery { return d.match.pattern }
+        if let i = liveIntrusion { return i.pattern }
+
+        // Pattern 3: 3+ door/window events in 15 seconds = Forced Entry
+        let doorCount = doorWindow.count - doorWindowHead
+        if doorCount >= 3 {
+            let events = Array(doorWindow[doorWindowHead...])
             return ChainPattern(
                 name: "forced_entry",
-                events: recentDoorEvents,
+                events: events,
                 threatDelta: 0.6,  // High threat increase
                 confidence: 0.92,
-                reasoning: "\(recentDoorEvents.count) door/window events in 15s = forced entry attempt"
+                reasoning: "\(events.count) door/window events in 15s = forced entry attempt"
             )
         }
-        
-        return nil
-    }
-    
-    /// Detect: Glass Break → Motion = Active Break-In
-    private func detectBreakInPattern() -> ChainPattern? {
-        guard eventBuffer.count >= 2 else { return nil }
-        
-        for i in 0..<(eventBuffer.count - 1) {
-            let event1 = eventBuffer[i]
-            let event2 = eventBuffer[i + 1]
-            
-            // Glass break followed by motion
-            if event1.type.contains("glass") && event2.type.contains("motion") {
-                let timeDiff = event2.timestamp.timeIntervalSince(event1.timestamp)
-                
-                // Within 20 seconds
-                if timeDiff <= 20 {
-                    return ChainPattern(
-                        name: "active_break_in",
-                        events: [event1, event2],
-                        threatDelta: 0.7,  // Critical threat increase
-                        confidence: 0.95,
-                        reasoning: "Glass break + motion = active break-in in progress"
-                    )
-                }
-            }
-        }
-        
-        return nil
-    }
-    
-    /// Detect: Motion in multiple zones in sequence = Prowler
-    private func detectProwlerPattern() -> ChainPattern? {
-        let last60Seconds = Date().addingTimeInterval(-60)
-        let recentMotion = eventBuffer.filter { event in
-            event.type.contains("motion") && event.timestamp >= last60Seconds
-        }
-        
-        // Motion in 3+ different locations within 60 seconds
-        let uniqueLocations = Set(recentMotion.map { $0.location })
-        if uniqueLocations.count >= 3 {
+
+        if let b = liveBreakIn { return b.pattern }
+
+        // Pattern 5: Motion in 3+ different locations within 60 seconds = Prowler
+        if motionLocationCounts.count >= 3 {
+            let events = Array(motionWindow[motionWindowHead...])
             return ChainPattern(
                 name: "prowler_activity",
-                events: recentMotion,
+                events: events,
                 threatDelta: 0.45,  // Elevated threat
                 confidence: 0.88,
-                reasoning: "Motion in \(uniqueLocations.count) zones in 60s = prowler pattern"
+                reasoning: "Motion in \(motionLocationCounts.count) zones in 60s = prowler pattern"
             )
         }
-        
+
         return nil
     }
-}
-
 
+    // MARK: - Window Maintenance
 
+    private func pruneDoorWindow(before cutoff: Date) {
+        while doorWindowHead < doorWindow.count, doorWindow[doorWindowHead].timestamp < cutoff {
+            doorWindowHead += 1
+        }
+        if doorWindowHead > 64 {
+            doorWindow.removeFirst(doorWindowHead)
+            doorWindowHead = 0
+        }
+    }
 
+    private func pruneMotionWindow(before cutoff: Date) {
+        while motionWindowHead < motionWindow.count, motionWindow[motionWindowHead].timestamp < cutoff {
+            let expired = motionWindow[motionWindowHead]
+            if let count = motionLocationCounts[expired.location] {
+                if count <= 1 {
+                    motionLocationCounts[expired.location] = nil
+                } else {
+                    motionLocationCounts[expired.location] = count - 1
+                }
+            }
+            motionWindowHead += 1
+        }
+        if motionWindowHead > 64 {
+            motionWindow.removeFirst(motionWindowHead)
+            motionWindowHead = 0
+        }
+    }
+}
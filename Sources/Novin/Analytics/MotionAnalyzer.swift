@@ -298,6 +298,215 @@ struct MotionFuzzyKernel {
     }
 }
 
+// MARK: - Batch fuzzy kernel (full-rate sensor streams)
+
+extension MotionAnalyzer {
+
+    /// One motion sample from a high-frequency stream
+    public struct FuzzyMotionSample {
+        public let duration: Double
+        public let energy: Double
+        public let hour: Int
+
+        public init(duration: Double, energy: Double, hour: Int) {
+            self.duration = duration
+            self.energy = energy
+            self.hour = hour
+        }
+    }
+
+    /// Compact per-sample fuzzy result: fixed intent slots, an enum intent,
+    /// and a rule bitmask — no dictionaries or strings per sample
+    public struct FuzzyMotionAssessment {
+        public enum Intent: String {
+            case delivery, loitering, prowler, pet, unknown
+        }
+
+        /// Which fuzzy rules fired, as bits (maps 1:1 to the rule names the
+        /// scalar `fuzzyAssess` reports)
+        public struct FiredRules: OptionSet {
+            public let rawValue: UInt8
+            public init(rawValue: UInt8) { self.rawValue = rawValue }
+            public static let delivery = FiredRules(rawValue: 1 << 0)
+            public static let loitering = FiredRules(rawValue: 1 << 1)
+            public static let prowler = FiredRules(rawValue: 1 << 2)
+            public static let pet = FiredRules(rawValue: 1 << 3)
+        }
+
+        public let intent: Intent
+        public let threat: Double
+        // Normalized intent scores (sum to 1 when any rule fired)
+        public let delivery: Double
+        public let loitering: Double
+        public let prowler: Double
+        public let pet: Double
+        public let fired: FiredRules
+    }
+
+    /// Assess a batch of motion samples from one stream in a single pass.
+    ///
+    /// Zone, home mode, and activity hint are per-stream constants; duration,
+    /// energy, and hour vary per sample. Membership functions are evaluated
+    /// with vDSP over the whole batch and results come back as compact value
+    /// structs, so a 10Hz camera stream can be assessed at full rate instead
+    /// of downsampled — per-call dictionary and rule-string assembly in the
+    /// scalar path was the bottleneck.
+    public static func fuzzyAssessBatch(samples: [FuzzyMotionSample],
+                                        zoneRisk: Double,
+                                        homeMode: String,
+                                        activityHint: String? = nil) -> [FuzzyMotionAssessment] {
+        let n = samples.count
+        guard n > 0 else { return [] }
+
+        var durations = [Double](repeating: 0, count: n)
+        var energies = [Double](repeating: 0, count: n)
+        var day = [Double](repeating: 0, count: n)
+        var night = [Double](repeating: 0, count: n)
+        for i in 0..<n {
+            durations[i] = samples[i].duration
+            energies[i] = samples[i].energy
+            let h = samples[i].hour
+            let isNight = (h < 6 || h >= 22) ? 1.0 : 0.0
+            night[i] = isNight
+            day[i] = 1.0 - isNight
+        }
+
+        // Vectorized memberships (same trapezoids as the scalar kernel)
+        let durS = vTrapmf(durations, 0, 0, 6, 10)
+        let durM = vTrapmf(durations, 6, 10, 20, 30)
+        let durL = vTrapmf(durations, 20, 30, 120, 999)
+        let eL = vTrapmf(energies, 0.0, 0.0, 0.1, 0.15)
+        let eM = vTrapmf(energies, 0.1, 0.18, 0.3, 0.4)
+        let eH = vTrapmf(energies, 0.3, 0.5, 1.0, 1.0)
+
+        // Per-stream constant memberships
+        let entry = trapmf(zoneRisk, 0.6, 0.65, 0.8, 1.0)
+        let perim = trapmf(zoneRisk, 0.5, 0.6, 0.7, 0.8)
+        let interior = trapmf(zoneRisk, 0.2, 0.25, 0.45, 0.55)
+        let home = homeMode == "home" ? 1.0 : 0.0
+        let away = homeMode == "away" ? 1.0 : 0.0
+        let vac = homeMode == "vacation" ? 1.0 : 0.0
+        let petHint = (activityHint == "pet") ? 1.0 : 0.0
+
+        // Rule strengths, one array pass each
+        // Delivery: min(durS, eL, entry, day)
+        var rDelivery = vMin(vMinScalar(vMin(durS, eL), entry), day)
+        // Loitering: min(durL, eM, max(away, vac))
+        var rLoitering = vMinScalar(vMin(durL, eM), max(away, vac))
+        // Prowler: min(durL, max(eM, eH)) * max(perim, night)
+        var rProwler = vMul(vMin(durL, vMax(eM, eH)), vMaxScalar(night, perim))
+        // Pet: min(home, eL) * max(interior, perim) * max(0.6, petHint)
+        var rPet = home == 0.0
+            ? [Double](repeating: 0, count: n)
+            : vScale(vMinScalar(eL, home), max(interior, perim) * max(0.6, petHint))
+
+        // Rule weights (identical to the scalar inference)
+        vDSP_vsmulD(rDelivery, 1, [0.85], &rDelivery, 1, vDSP_Length(n))
+        vDSP_vsmulD(rLoitering, 1, [0.8], &rLoitering, 1, vDSP_Length(n))
+        vDSP_vsmulD(rProwler, 1, [0.85], &rProwler, 1, vDSP_Length(n))
+        vDSP_vsmulD(rPet, 1, [0.9], &rPet, 1, vDSP_Length(n))
+
+        // Normalize, map threat, pick intent — straight-line scalar work over
+        // four slots per sample, no collections allocated
+        var out = [FuzzyMotionAssessment]()
+        out.reserveCapacity(n)
+        for i in 0..<n {
+            let d = rDelivery[i], l = rLoitering[i], p = rProwler[i], pe = rPet[i]
+            var fired: FuzzyMotionAssessment.FiredRules = []
+            if d > 0 { fired.insert(.delivery) }
+            if l > 0 { fired.insert(.loitering) }
+            if p > 0 { fired.insert(.prowler) }
+            if pe > 0 { fired.insert(.pet) }
+
+            let total = max(1e-9, d + l + p + pe)
+            let nd = d / total, nl = l / total, np = p / total, npe = pe / total
+            let threat = nd * 0.2 + npe * 0.1 + nl * 0.5 + np * 0.75
+
+            let intent: FuzzyMotionAssessment.Intent
+            if fired.isEmpty {
+                intent = .unknown
+            } else {
+                let best = max(nd, max(nl, max(np, npe)))
+                if best == nd { intent = .delivery }
+                else if best == nl { intent = .loitering }
+                else if best == np { intent = .prowler }
+                else { intent = .pet }
+            }
+
+            out.append(FuzzyMotionAssessment(
+                intent: intent,
+                threat: threat,
+                delivery: nd,
+                loitering: nl,
+                prowler: np,
+                pet: npe,
+                fired: fired
+            ))
+        }
+        return out
+    }
+
+    // MARK: vDSP helpers
+
+    /// Trapezoid membership over a whole vector:
+    /// clip(min((x-a)/(b-a), (d-x)/(d-c)), 0, 1)
+    private static func vTrapmf(_ x: [Double], _ a: Double, _ b: Double, _ c: Double, _ d: Double) -> [Double] {
+        let n = vDSP_Length(x.count)
+        var up = [Double](repeating: 0, count: x.count)
+        var down = [Double](repeating: 0, count: x.count)
+        var upMul = 1.0 / max(1e-9, b - a)
+        var upAdd = -a / max(1e-9, b - a)
+        var downMul = -1.0 / max(1e-9, d - c)
+        var downAdd = d / max(1e-9, d - c)
+        vDSP_vsmsaD(x, 1, &upMul, &upAdd, &up, 1, n)
+        vDSP_vsmsaD(x, 1, &downMul, &downAdd, &down, 1, n)
+        var out = [Double](repeating: 0, count: x.count)
+        vDSP_vminD(up, 1, down, 1, &out, 1, n)
+        var lo = 0.0, hi = 1.0
+        vDSP_vclipD(out, 1, &lo, &hi, &out, 1, n)
+        return out
+    }
+
+    private static func vMin(_ a: [Double], _ b: [Double]) -> [Double] {
+        var out = [Double](repeating: 0, count: a.count)
+        vDSP_vminD(a, 1, b, 1, &out, 1, vDSP_Length(a.count))
+        return out
+    }
+
+    private static func vMax(_ a: [Double], _ b: [Double]) -> [Double] {
+        var out = [Double](repeating: 0, count: a.count)
+        vDSP_vmaxD(a, 1, b, 1, &out, 1, vDSP_Length(a.count))
+        return out
+    }
+
+    private static func vMinScalar(_ a: [Double], _ c: Double) -> [Double] {
+        var out = [Double](repeating: 0, count: a.count)
+        var lo = -Double.greatestFiniteMagnitude, hi = c
+        vDSP_vclipD(a, 1, &lo, &hi, &out, 1, vDSP_Length(a.count))
+        return out
+    }
+
+    private static func vMaxScalar(_ a: [Double], _ c: Double) -> [Double] {
+        var out = [Double](repeating: 0, count: a.count)
+        var lo = c, hi = Double.greatestFiniteMagnitude
+        vDSP_vclipD(a, 1, &lo, &hi, &out, 1, vDSP_Length(a.count))
+        return out
+    }
+
+    private static func vMul(_ a: [Double], _ b: [Double]) -> [Double] {
+        var out = [Double](repeating: 0, count: a.count)
+        vDSP_vmulD(a, 1, b, 1, &out, 1, vDSP_Length(a.count))
+        return out
+    }
+
+    private static func vScale(_ a: [Double], _ c: Double) -> [Double] {
+        var out = [Double](repeating: 0, count: a.count)
+        var scalar = c
+        vDSP_vsmulD(a, 1, &scalar, &out, 1, vDSP_Length(a.count))
+        return out
+    }
+}
+
 extension MotionAnalyzer {
     /// Fuzzy assessment helper for metadata-driven motion analysis
     /// - Returns: intent label, crisp threat in 0..1, and fired fuzzy rules
@@ -83,37 +83,133 @@ public struct ZoneClassifier {
     ]
     
     // MARK: - Classification
-    
+
     private let zones: [Zone]
-    
-    /// Initialize with custom zones
+    // Compiled at configuration time: every normalized zone name and alias
+    // maps to its zone index, so the common resolution path is one hash
+    // lookup instead of walking zone and alias arrays per call. Installations
+    // with 60+ zones and multiple aliases each make the linear scan visible.
+    private let zoneIdsByName: [String: Int]
+    private let unknownZone: Zone
+
+    // MARK: - Spatial Index
+    //
+    // Uniform grid over fence bounding boxes, built at configuration time.
+    // Lat/lon project to local meters (equirectangular around the fence
+    // centroid latitude — fine at geofence scale), each fence registers in
+    // every cell its bounding box overlaps, and a point query touches exactly
+    // one cell. Commercial sites with hundreds of fenced zones resolve a GPS
+    // fix in microseconds instead of a linear fence scan.
+
+    private struct FenceEntry {
+        let zoneIndex: Int
+        let x: Double       // fence center, local meters
+        let y: Double
+        let radius: Double
+    }
+
+    private let fenceEntries: [FenceEntry]
+    private let gridCells: [Int64: [Int]]
+    private let gridCellSize: Double
+    private let gridOriginLat: Double
+    private let gridOriginLon: Double
+    private let metersPerDegLon: Double
+    private static let metersPerDegLat = 111_320.0
+
+    /// Initialize with custom zones (compiles the name/alias lookup table
+    /// and the geofence grid index)
     public init(zones: [Zone] = defaultZones) {
         self.zones = zones
+        var table: [String: Int] = [:]
+        // Names first, then aliases, first definition wins — preserves the
+        // precedence of the previous name-scan-then-alias-scan resolution
+        for (index, zone) in zones.enumerated() where table[Self.normalize(zone.name)] == nil {
+            table[Self.normalize(zone.name)] = index
+        }
+        for (index, zone) in zones.enumerated() {
+            for alias in zone.aliases where table[Self.normalize(alias)] == nil {
+                table[Self.normalize(alias)] = index
+            }
+        }
+        self.zoneIdsByName = table
+        self.unknownZone = zones.first { $0.name == "unknown" } ?? Zone(name: "unknown", riskScore: 0.50, type: .publicArea)
+
+        // Build the grid from whatever fences are configured
+        let fenced: [(Int, Geofence)] = zones.enumerated().compactMap { index, zone in
+            zone.geofence.map { (index, $0) }
+        }
+        guard !fenced.isEmpty else {
+            fenceEntries = []
+            gridCells = [:]
+            gridCellSize = 1
+            gridOriginLat = 0
+            gridOriginLon = 0
+            metersPerDegLon = Self.metersPerDegLat
+            return
+        }
+
+        let midLat = fenced.reduce(0.0) { $0 + $1.1.centerLat } / Double(fenced.count)
+        let mPerDegLon = Self.metersPerDegLat * cos(midLat * .pi / 180.0)
+        let originLat = fenced.map { $0.1.centerLat }.min()!
+        let originLon = fenced.map { $0.1.centerLon }.min()!
+        // Cell size on the order of the largest fence keeps per-fence cell
+        // coverage small while still pruning distant fences
+        let cellSize = max(10.0, fenced.map { $0.1.radiusMeters }.max()!)
+
+        var entries: [FenceEntry] = []
+        entries.reserveCapacity(fenced.count)
+        var cells: [Int64: [Int]] = [:]
+        for (zoneIndex, fence) in fenced {
+            let x = (fence.centerLon - originLon) * mPerDegLon
+            let y = (fence.centerLat - originLat) * Self.metersPerDegLat
+            let entryIndex = entries.count
+            entries.append(FenceEntry(zoneIndex: zoneIndex, x: x, y: y, radius: fence.radiusMeters))
+
+            let minCX = Int(floor((x - fence.radiusMeters) / cellSize))
+            let maxCX = Int(floor((x + fence.radiusMeters) / cellSize))
+            let minCY = Int(floor((y - fence.radiusMeters) / cellSize))
+            let maxCY = Int(floor((y + fence.radiusMeters) / cellSize))
+            for cx in minCX...maxCX {
+                for cy in minCY...maxCY {
+                    cells[Self.cellKey(cx, cy), default: []].append(entryIndex)
+                }
+            }
+        }
+        fenceEntries = entries
+        gridCells = cells
+        gridCellSize = cellSize
+        gridOriginLat = originLat
+        gridOriginLon = originLon
+        metersPerDegLon = mPerDegLon
     }
-    
-    /// Classify a location string to a zone
-    public func classifyLocation(_ location: String) -> Zone {
-        let normalized = location.lowercased()
+
+    private static func cellKey(_ cx: Int, _ cy: Int) -> Int64 {
+        return (Int64(cx) << 32) | Int64(UInt32(bitPattern: Int32(truncatingIfNeeded: cy)))
+    }
+
+    /// Case/whitespace-folded form used as the lookup key
+    private static func normalize(_ location: String) -> String {
+        return location.lowercased()
             .replacingOccurrences(of: " ", with: "_")
             .trimmingCharacters(in: .whitespacesAndNewlines)
-        
-        // Direct name match
-        if let zone = zones.first(where: { $0.name == normalized }) {
-            return zone
-        }
-        
-        // Alias match
-        if let zone = zones.first(where: { $0.aliases.contains(normalized) }) {
-            return zone
+    }
+
+    /// Classify a location string to a zone
+    public func classifyLocation(_ location: String) -> Zone {
+        let normalized = Self.normalize(location)
+
+        // Direct name or alias match: O(1) via the compiled table
+        if let index = zoneIdsByName[normalized] {
+            return zones[index]
         }
-        
+
         // Partial match (e.g., "front_door_camera" → "front_door")
         if let zone = zones.first(where: { normalized.contains($0.name) }) {
             return zone
         }
-        
+
         // Fallback to unknown
-        return zones.first { $0.name == "unknown" } ?? Zone(name: "unknown", riskScore: 0.50, type: .publicArea)
+        return unknownZone
     }
     
     /// Get risk score for location
@@ -141,9 +237,58 @@ public struct ZoneClassifier {
     /// Get adjacent zones
     public func getAdjacentZones(for location: String) -> [Zone] {
         let zone = classifyLocation(location)
+        return resolveAdjacent(zone)
+    }
+
+    /// Adjacent zone names resolve through the compiled table, so walking an
+    /// adjacency chain never rescans the zone array
+    private func resolveAdjacent(_ zone: Zone) -> [Zone] {
         return zone.adjacentZones.compactMap { adjacentName in
-            zones.first { $0.name == adjacentName }
+            zoneIdsByName[Self.normalize(adjacentName)].map { zones[$0] }
+        }
+    }
+
+    // MARK: - Geofence Queries
+
+    /// All zones whose geofence contains the given coordinate.
+    ///
+    /// Touches only the grid cell the point falls in, then distance-checks
+    /// that cell's candidate fences — O(candidates), not O(zones).
+    public func zones(containingLat lat: Double, lon: Double) -> [Zone] {
+        guard !fenceEntries.isEmpty else { return [] }
+        let x = (lon - gridOriginLon) * metersPerDegLon
+        let y = (lat - gridOriginLat) * Self.metersPerDegLat
+        let key = Self.cellKey(Int(floor(x / gridCellSize)), Int(floor(y / gridCellSize)))
+        guard let candidates = gridCells[key] else { return [] }
+
+        var out: [Zone] = []
+        for index in candidates {
+            let fence = fenceEntries[index]
+            let dx = x - fence.x
+            let dy = y - fence.y
+            if dx * dx + dy * dy <= fence.radius * fence.radius {
+                out.append(zones[fence.zoneIndex])
+            }
+        }
+        return out
+    }
+
+    /// Adjacency-aware geofence lookup: the zones containing the coordinate
+    /// plus their declared `adjacentZones`, deduplicated. Gives chain and
+    /// escalation analysis the neighborhood of a GPS fix in one call.
+    public func zonesWithAdjacency(containingLat lat: Double, lon: Double) -> (contained: [Zone], adjacent: [Zone]) {
+        let contained = zones(containingLat: lat, lon: lon)
+        guard !contained.isEmpty else { return ([], []) }
+
+        var containedNames = Set(contained.map { $0.name })
+        var adjacent: [Zone] = []
+        for zone in contained {
+            for neighbor in resolveAdjacent(zone) where !containedNames.contains(neighbor.name) {
+                containedNames.insert(neighbor.name)
+                adjacent.append(neighbor)
+            }
         }
+        return (contained, adjacent)
     }
     
     /// Calculate risk escalation based on zone sequence
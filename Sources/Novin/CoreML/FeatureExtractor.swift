@@ -17,29 +17,80 @@ struct FeatureExtractorSwift {
     private static let monthSin: [Double] = (0..<monthsInYear).map { sin(2 * .pi * Double($0 + 1) / Double(monthsInYear)) }
     private static let monthCos: [Double] = (0..<monthsInYear).map { cos(2 * .pi * Double($0 + 1) / Double(monthsInYear)) }
 
-    // Public API
-    func extract(from request: [String: Any]) -> [Float] {
-        var feats: [String: Double] = [:]
+    /// Sparse feature representation: (slot, value) pairs over the hashed
+    /// feature space. An event produces ~30 live features, so carrying pairs
+    /// instead of a dense 16K-element vector avoids 64KB of zeroed memory per
+    /// extraction; the dense form is materialized lazily only when a consumer
+    /// actually needs it.
+    struct SparseFeatureVector {
+        let slots: [Int]
+        let values: [Float]
+
+        var count: Int { slots.count }
+
+        /// Materialize the dense hashed vector (allocates; call only when a
+        /// consumer requires dense layout)
+        func densified(size: Int = Config.maxFeatures) -> [Float] {
+            var vector = [Float](repeating: 0, count: size)
+            for i in 0..<slots.count {
+                vector[slots[i]] = values[i]
+            }
+            return vector
+        }
+    }
+
+    // MARK: - Canonical named-feature layout
 
+    /// Every key `extractNamedFeatures` can emit, in a stable order. Consumers
+    /// that keep per-feature state (NormalityTracker) index contiguous arrays
+    /// by these slots instead of hashing key strings per event. `zone_risk` is
+    /// injected by the pipeline after extraction but belongs to the layout.
+    static let namedFeatureNames: [String] = [
         // Temporal
-        addTemporalFeatures(from: request, into: &feats)
+        "hour_sin", "hour_cos", "weekday_sin", "weekday_cos",
+        "month_sin", "month_cos", "is_weekend", "hours_since_last_event",
         // Spatial
-        addSpatialFeatures(from: request, into: &feats)
-        // Event features (supports either top-level fields or first item under "events")
-        let event = extractPrimaryEvent(from: request)
-        addEventFeatures(from: event, into: &feats)
+        "latitude_norm", "longitude_norm",
+        "crime_rate_24h", "crime_rate_7d", "crime_rate_30d",
+        "nearby_incidents", "crime_severity",
+        // Event
+        "event_motion", "event_sound", "event_door", "event_window",
+        "event_face", "event_smoke", "event_fire", "event_glassbreak",
+        "event_pet", "event_vehicle",
+        "event_confidence", "event_duration", "event_intensity", "sensor_count",
         // Behavioral
-        addBehavioralFeatures(from: request, into: &feats)
+        "recent_activity_freq", "user_risk_score", "user_trust_level", "activity_consistency",
         // Environmental
-        addEnvironmentalFeatures(from: request, into: &feats)
+        "temperature", "humidity", "precipitation", "wind_speed", "is_daylight",
+        "season_winter", "season_spring", "season_summer", "season_fall",
+        // Injected by the pipeline
+        "zone_risk"
+    ]
+
+    /// Name → slot index over `namedFeatureNames`
+    static let namedFeatureSlots: [String: Int] =
+        Dictionary(uniqueKeysWithValues: namedFeatureNames.enumerated().map { ($1, $0) })
 
-        // Vectorize via MurmurHash3-32 slots
-        var vector = [Float](repeating: 0, count: Config.maxFeatures)
+    // Public API
+
+    /// Extract features in sparse form (primary representation)
+    func extractSparse(from request: [String: Any]) -> SparseFeatureVector {
+        let feats = extractNamedFeatures(from: request)
+        var slots: [Int] = []
+        var values: [Float] = []
+        slots.reserveCapacity(feats.count)
+        values.reserveCapacity(feats.count)
         for (name, value) in feats {
-            let slot = featureSlot(name)
-            vector[slot] = Float(value)
+            slots.append(featureSlot(name))
+            values.append(Float(value))
         }
-        return vector
+        return SparseFeatureVector(slots: slots, values: values)
+    }
+
+    /// Extract features as a dense hashed vector (legacy consumers only;
+    /// prefer extractSparse to avoid the 64KB dense allocation per event)
+    func extract(from request: [String: Any]) -> [Float] {
+        return extractSparse(from: request).densified()
     }
 
     /// New: Extract named features for math+rules pipeline
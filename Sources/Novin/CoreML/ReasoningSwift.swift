@@ -27,9 +27,38 @@ public struct ReasoningSwift {
     // MARK: - Rules storage
     private var rules: [Rule] = []
 
+    // MARK: - Compiled rule index
+    // Condition names interned to integer IDs at load time, plus an inverted
+    // condition → rules index. Partner rule packs repeat the same condition
+    // strings across hundreds of rules, so each distinct condition is
+    // evaluated exactly once per event and only candidate rules (those
+    // sharing at least one satisfied condition) are visited.
+    private var conditionIds: [String: Int] = [:]
+    private var conditionNames: [String] = []
+    private var rulesByCondition: [[Int]] = []
+
     // MARK: - Public API
     @discardableResult
     public mutating func loadRules() -> Int {
+        // Compiled pack first: one read and a linear walk over length-prefixed
+        // records, with the interned condition table taken straight from the
+        // file (see RulePack). JSON below remains the development fallback.
+        if let url = Bundle.module.url(forResource: "rules", withExtension: "pack", subdirectory: "Rules") ??
+                     Bundle.module.url(forResource: "rules", withExtension: "pack"),
+           let data = try? Data(contentsOf: url),
+           let pack = RulePack.decode(data) {
+            self.rules = pack.rules.map { r in
+                Rule(name: r.name, conditions: r.conditionIds.map { pack.conditionNames[$0] }, weight: r.weight, score: r.score, description: r.description)
+            }
+            self.conditionNames = pack.conditionNames
+            self.conditionIds = Dictionary(uniqueKeysWithValues: pack.conditionNames.enumerated().map { ($1, $0) })
+            self.rulesByCondition = [[Int]](repeating: [], count: pack.conditionNames.count)
+            for (ruleIdx, r) in pack.rules.enumerated() {
+                for id in r.conditionIds { rulesByCondition[id].append(ruleIdx) }
+            }
+            return rules.count
+        }
+
         // Load from bundled JSON if available (SPM resources)
         if let url = Bundle.module.url(forResource: "rules", withExtension: "json", subdirectory: "Rules") ??
                      Bundle.module.url(forResource: "rules", withExtension: "json"),
@@ -42,6 +71,7 @@ public struct ReasoningSwift {
                       let score = d["score"] as? Double else { return nil }
                 return Rule(name: name, conditions: conditions, weight: weight, score: score, description: d["description"] as? String)
             }
+            compileRules()
             return rules.count
         }
         // Fallback minimal rules
@@ -49,11 +79,37 @@ public struct ReasoningSwift {
             Rule(name: "night_motion_suspicious", conditions: ["time_night", "event_motion"], weight: 1.5, score: 0.75, description: nil),
             Rule(name: "door_open_away", conditions: ["away_mode", "event_door"], weight: 2.0, score: 0.9, description: nil)
         ]
+        compileRules()
         let fallbackCount = self.rules.count
         Logger(subsystem: "com.novinintelligence", category: "rules").warning("Rules JSON not found in bundle; using fallback rules (\(fallbackCount)).")
         return rules.count
     }
 
+    /// Intern condition names and build the inverted condition → rules index.
+    /// Called once per loadRules(); per-event cost drops from
+    /// O(rules × conditions) to one pass over distinct conditions plus
+    /// O(candidate rules).
+    private mutating func compileRules() {
+        conditionIds.removeAll(keepingCapacity: true)
+        conditionNames.removeAll(keepingCapacity: true)
+        rulesByCondition.removeAll(keepingCapacity: true)
+
+        for (ruleIdx, rule) in rules.enumerated() {
+            for cond in rule.conditions {
+                let id: Int
+                if let existing = conditionIds[cond] {
+                    id = existing
+                } else {
+                    id = conditionNames.count
+                    conditionIds[cond] = id
+                    conditionNames.append(cond)
+                    rulesByCondition.append([])
+                }
+                rulesByCondition[id].append(ruleIdx)
+            }
+        }
+    }
+
     func reason(request: [String: Any], features: [String: Double]? = nil) -> Result {
         // Enhanced reasoning: Combine traditional rules with CoT reasoning
         let traditionalResult = reasonTraditional(request: request, features: features)
@@ -83,9 +139,31 @@ public struct ReasoningSwift {
 
     // MARK: - Rule evaluation
     private func applyRules(request: [String: Any], features: [String: Double]?) -> [RuleMatch] {
+        guard !rules.isEmpty else { return [] }
+
+        // Evaluate each distinct condition exactly once per event
+        var satisfied = [Bool](repeating: false, count: conditionNames.count)
+        for id in 0..<conditionNames.count {
+            satisfied[id] = evaluateCondition(conditionNames[id], features: features, request: request)
+        }
+
+        // Count matches through the inverted index; only rules sharing at
+        // least one satisfied condition are ever touched
+        var matchCounts = [Int](repeating: 0, count: rules.count)
+        var candidates: [Int] = []
+        for id in 0..<satisfied.count where satisfied[id] {
+            for ruleIdx in rulesByCondition[id] {
+                if matchCounts[ruleIdx] == 0 { candidates.append(ruleIdx) }
+                matchCounts[ruleIdx] += 1
+            }
+        }
+        candidates.sort()  // deterministic rule-pack order
+
         var results: [RuleMatch] = []
-        for r in rules {
-            if evaluate(rule: r, request: request, features: features) {
+        for ruleIdx in candidates {
+            let r = rules[ruleIdx]
+            let ratio = Double(matchCounts[ruleIdx]) / Double(max(1, r.conditions.count))
+            if ratio >= 0.7 {
                 let conf = calculateRuleConfidence(rule: r, request: request, features: features)
                 results.append(RuleMatch(name: r.name, weight: r.weight, score: r.score, confidence: conf))
             }
@@ -93,15 +171,6 @@ public struct ReasoningSwift {
         return results
     }
 
-    private func evaluate(rule: Rule, request: [String: Any], features: [String: Double]?) -> Bool {
-        var matched = 0
-        for cond in rule.conditions {
-            if evaluateCondition(cond, features: features, request: request) { matched += 1 }
-        }
-        let ratio = Double(matched) / Double(max(1, rule.conditions.count))
-        return ratio >= 0.7
-    }
-
     private func evaluateCondition(_ condition: String, features: [String: Double]?, request: [String: Any]) -> Bool {
         // Temporal
         if condition == "time_night" { return (features?["hour_cos"] ?? 0.0) < -0.5 }
@@ -0,0 +1,210 @@
+import Foundation
+
+/// Versioned binary rule pack format.
+///
+/// `rules.json` is the authoring format; shipping builds can bundle a
+/// compiled `rules.pack` produced by the `NovinRuleCompiler` tool. The pack
+/// stores the interned condition table once and references conditions by ID
+/// per rule, so `loadRules()` turns into a single read plus a linear walk
+/// over length-prefixed records — no JSONSerialization, no per-entry
+/// dictionary casts, no string interning at startup. The JSON path remains
+/// the development fallback.
+///
+/// Layout (all integers little-endian):
+///
+///     magic   UInt32  "NVRP"
+///     version UInt32  (currently 1)
+///     conditionCount UInt32, then per condition: UInt16 length + UTF-8 bytes
+///     ruleCount      UInt32, then per rule:
+///         UInt16 name length + UTF-8 bytes
+///         Float64 weight, Float64 score (bit patterns)
+///         UInt16 condition count, then UInt16 condition IDs
+///         UInt16 description length (0xFFFF = none) + UTF-8 bytes
+public enum RulePack {
+
+    public static let magic: UInt32 = 0x4E56_5250  // "NVRP"
+    public static let version: UInt32 = 1
+
+    /// One decoded rule; conditions reference the pack's interned table
+    public struct Rule {
+        public let name: String
+        public let conditionIds: [Int]
+        public let weight: Double
+        public let score: Double
+        public let description: String?
+    }
+
+    /// Fully decoded pack: interned condition names plus rules over them
+    public struct Decoded {
+        public let conditionNames: [String]
+        public let rules: [Rule]
+    }
+
+    // MARK: - Compilation (offline tool / tests)
+
+    /// Compile authoring JSON (the `rules.json` array format) into pack bytes
+    public static func compile(fromJSON data: Data) throws -> Data {
+        guard let array = try JSONSerialization.jsonObject(with: data) as? [[String: Any]] else {
+            throw NovinIntelligenceError.invalidInput("rules JSON is not an array of objects")
+        }
+
+        var conditionIds: [String: Int] = [:]
+        var conditionNames: [String] = []
+        var rules: [Rule] = []
+        for entry in array {
+            guard let name = entry["name"] as? String,
+                  let conditions = entry["conditions"] as? [String],
+                  let weight = entry["weight"] as? Double,
+                  let score = entry["score"] as? Double else { continue }
+            let ids = conditions.map { cond -> Int in
+                if let id = conditionIds[cond] { return id }
+                let id = conditionNames.count
+                conditionIds[cond] = id
+                conditionNames.append(cond)
+                return id
+            }
+            rules.append(Rule(name: name, conditionIds: ids, weight: weight, score: score, description: entry["description"] as? String))
+        }
+        return encode(Decoded(conditionNames: conditionNames, rules: rules))
+    }
+
+    /// Encode a decoded pack into the binary layout
+    public static func encode(_ pack: Decoded) -> Data {
+        var out = Data()
+        append(magic, to: &out)
+        append(version, to: &out)
+
+        append(UInt32(pack.conditionNames.count), to: &out)
+        for name in pack.conditionNames {
+            appendString(name, to: &out)
+        }
+
+        append(UInt32(pack.rules.count), to: &out)
+        for rule in pack.rules {
+            appendString(rule.name, to: &out)
+            append(rule.weight.bitPattern, to: &out)
+            append(rule.score.bitPattern, to: &out)
+            append(UInt16(rule.conditionIds.count), to: &out)
+            for id in rule.conditionIds {
+                append(UInt16(id), to: &out)
+            }
+            if let description = rule.description {
+                appendString(description, to: &out)
+            } else {
+                append(UInt16(0xFFFF), to: &out)
+            }
+        }
+        return out
+    }
+
+    // MARK: - Decoding (startup hot path)
+
+    /// Decode pack bytes; returns nil on magic/version mismatch or truncation,
+    /// letting callers fall back to the JSON path
+    public static func decode(_ data: Data) -> Decoded? {
+        var cursor = Cursor(data: data)
+        guard cursor.readUInt32() == magic, cursor.readUInt32() == version else { return nil }
+
+        guard let conditionCount = cursor.readUInt32() else { return nil }
+        var conditionNames: [String] = []
+        conditionNames.reserveCapacity(Int(conditionCount))
+        for _ in 0..<conditionCount {
+            guard let name = cursor.readString() else { return nil }
+            conditionNames.append(name)
+        }
+
+        guard let ruleCount = cursor.readUInt32() else { return nil }
+        var rules: [Rule] = []
+        rules.reserveCapacity(Int(ruleCount))
+        for _ in 0..<ruleCount {
+            guard let name = cursor.readString(),
+                  let weightBits = cursor.readUInt64(),
+                  let scoreBits = cursor.readUInt64(),
+                  let condCount = cursor.readUInt16() else { return nil }
+            var ids: [Int] = []
+            ids.reserveCapacity(Int(condCount))
+            for _ in 0..<condCount {
+                guard let id = cursor.readUInt16(), Int(id) < conditionNames.count else { return nil }
+                ids.append(Int(id))
+            }
+            let description: String?
+            switch cursor.readOptionalString() {
+            case .present(let string): description = string
+            case .absent: description = nil
+            case .truncated: return nil
+            }
+            rules.append(Rule(
+                name: name,
+                conditionIds: ids,
+                weight: Double(bitPattern: weightBits),
+                score: Double(bitPattern: scoreBits),
+                description: description
+            ))
+        }
+        return Decoded(conditionNames: conditionNames, rules: rules)
+    }
+
+    // MARK: - Byte helpers
+
+    private static func append<T: FixedWidthInteger>(_ value: T, to data: inout Data) {
+        var le = value.littleEndian
+        withUnsafeBytes(of: &le) { data.append(contentsOf: $0) }
+    }
+
+    private static func appendString(_ string: String, to data: inout Data) {
+        let bytes = Array(string.utf8)
+        append(UInt16(min(bytes.count, 0xFFFE)), to: &data)
+        data.append(contentsOf: bytes.prefix(0xFFFE))
+    }
+
+    private struct Cursor {
+        let data: Data
+        var offset: Int = 0
+
+        init(data: Data) { self.data = data }
+
+        mutating func read<T: FixedWidthInteger>(_ type: T.Type) -> T? {
+            let size = MemoryLayout<T>.size
+            guard offset + size <= data.count else { return nil }
+            var value: T = 0
+            withUnsafeMutableBytes(of: &value) { dest in
+                data.copyBytes(to: dest, from: (data.startIndex + offset)..<(data.startIndex + offset + size))
+            }
+            offset += size
+            return T(littleEndian: value)
+        }
+
+        mutating func readUInt16() -> UInt16? { read(UInt16.self) }
+        mutating func readUInt32() -> UInt32? { read(UInt32.self) }
+        mutating func readUInt64() -> UInt64? { read(UInt64.self) }
+
+        mutating func readString() -> String? {
+            guard let length = readUInt16(), length != 0xFFFF else { return nil }
+            guard offset + Int(length) <= data.count else { return nil }
+            let start = data.startIndex + offset
+            let string = String(data: data[start..<(start + Int(length))], encoding: .utf8)
+            offset += Int(length)
+            return string
+        }
+
+        /// Result of reading an optional string field. "Absent" (the 0xFFFF
+        /// sentinel) and "unreadable" must stay distinct: a pack truncated at
+        /// an optional field has to fail decoding, not decode as nil.
+        enum OptionalString {
+            case present(String)
+            case absent
+            case truncated
+        }
+
+        /// Like readString, but 0xFFFF decodes to `.absent`; a missing length
+        /// word or cut-off bytes report `.truncated`
+        mutating func readOptionalString() -> OptionalString {
+            let saved = offset
+            guard let length = read(UInt16.self) else { return .truncated }
+            if length == 0xFFFF { return .absent }
+            offset = saved
+            guard let string = readString() else { return .truncated }
+            return .present(string)
+        }
+    }
+}
@@ -12,7 +12,42 @@ public final class SymbolicReasoningEngine {
 
     public init() {}
 
-    /// Compute a plan from world state to a goal description using A* (placeholder)
+    // MARK: - Compact Planner State
+
+    /// Bitmask world state used inside A*. Predicates are interned to bit
+    /// indices once per plan() call, so applying an operator is two bit flips
+    /// on a small word array instead of duplicating the whole
+    /// `WorldStateGraph` (objects, relations and predicate set) per expansion.
+    private struct BitState: Hashable {
+        var words: [UInt64]
+
+        init(bitCount: Int) {
+            words = [UInt64](repeating: 0, count: (bitCount + 63) / 64)
+        }
+
+        func contains(_ bit: Int) -> Bool {
+            return words[bit >> 6] & (1 << UInt64(bit & 63)) != 0
+        }
+
+        mutating func set(_ bit: Int) {
+            words[bit >> 6] |= 1 << UInt64(bit & 63)
+        }
+
+        mutating func clear(_ bit: Int) {
+            words[bit >> 6] &= ~(1 << UInt64(bit & 63))
+        }
+
+        /// Successor with one bit cleared and one set — the whole cost of a
+        /// node expansion
+        func applying(clearing: Int, setting: Int) -> BitState {
+            var next = self
+            next.clear(clearing)
+            next.set(setting)
+            return next
+        }
+    }
+
+    /// Compute a plan from world state to a goal description using A*
     public func plan(initial: WorldStateGraph,
                      goalDescription: [Predicate],
                      constraints: [Constraint] = [],
@@ -22,62 +57,77 @@ public final class SymbolicReasoningEngine {
         // Stages: observe -> analyze -> decide -> act
         // Represented as predicates: stage_observe, stage_analyze, stage_decide, stage_act
 
+        let stageObserve = Predicate("stage_observe")
+        let stageAnalyze = Predicate("stage_analyze")
+        let stageDecide = Predicate("stage_decide")
+        let stageAct = Predicate("stage_act")
+
+        // Intern every predicate the search can touch: the initial state,
+        // the goal, and the four pipeline stages
+        var ids: [Predicate: Int] = [:]
+        var interned: [Predicate] = []
+        func intern(_ p: Predicate) -> Int {
+            if let id = ids[p] { return id }
+            let id = interned.count
+            ids[p] = id
+            interned.append(p)
+            return id
+        }
+        for p in initial.predicates { _ = intern(p) }
+        for p in goalDescription { _ = intern(p) }
+        let observeId = intern(stageObserve)
+        let analyzeId = intern(stageAnalyze)
+        let decideId = intern(stageDecide)
+        let actId = intern(stageAct)
+
+        // Operators are precondition bit + (clear, set) bit pair
         struct Operator {
             let name: String
-            let precond: (WorldStateGraph) -> Bool
-            let apply: (WorldStateGraph) -> WorldStateGraph
+            let precondBit: Int
+            let clearBit: Int
+            let setBit: Int
             let cost: Double
         }
-
-        // Build operators
         let ops: [Operator] = [
-            Operator(
-                name: "observe",
-                precond: { g in g.predicates.contains(Predicate("stage_observe")) },
-                apply: { g in let ng = g.copy(); ng.removePredicate(Predicate("stage_observe")); ng.addPredicate(Predicate("stage_analyze")); return ng },
-                cost: 1.0
-            ),
-            Operator(
-                name: "analyze",
-                precond: { g in g.predicates.contains(Predicate("stage_analyze")) },
-                apply: { g in let ng = g.copy(); ng.removePredicate(Predicate("stage_analyze")); ng.addPredicate(Predicate("stage_decide")); return ng },
-                cost: 1.0
-            ),
-            Operator(
-                name: "decide",
-                precond: { g in g.predicates.contains(Predicate("stage_decide")) },
-                apply: { g in let ng = g.copy(); ng.removePredicate(Predicate("stage_decide")); ng.addPredicate(Predicate("stage_act")); return ng },
-                cost: 1.0
-            )
+            Operator(name: "observe", precondBit: observeId, clearBit: observeId, setBit: analyzeId, cost: 1.0),
+            Operator(name: "analyze", precondBit: analyzeId, clearBit: analyzeId, setBit: decideId, cost: 1.0),
+            Operator(name: "decide", precondBit: decideId, clearBit: decideId, setBit: actId, cost: 1.0)
         ]
 
-        // Ensure initial has a stage
-        let start = initial.ensureStage()
-        let goalPreds: Set<Predicate> = goalDescription.isEmpty ? [Predicate("stage_act")] : Set(goalDescription)
+        // Encode initial state, ensuring it carries a stage
+        var start = BitState(bitCount: interned.count)
+        for p in initial.predicates { start.set(ids[p]!) }
+        if !start.contains(observeId) && !start.contains(analyzeId) &&
+            !start.contains(decideId) && !start.contains(actId) {
+            start.set(observeId)
+        }
 
-        // A* over tiny state space; use simple arrays for open set
-        typealias Node = (g: WorldStateGraph, gCost: Double, fCost: Double, path: [Action])
+        let goalBits: Set<Int> = goalDescription.isEmpty ? [actId] : Set(goalDescription.map { ids[$0]! })
 
-        var open: [Node] = []
-        var best: [String: Double] = [:]
-
-        func isGoal(_ g: WorldStateGraph) -> Bool {
-            for p in goalPreds { if !g.predicates.contains(p) { return false } }
+        func isGoal(_ s: BitState) -> Bool {
+            for bit in goalBits { if !s.contains(bit) { return false } }
             return true
         }
 
-        func h(_ g: WorldStateGraph) -> Double {
-            if let hf = heuristic { return max(0.0, hf(g)) }
+        // Custom heuristics still see a WorldStateGraph; one is materialized
+        // per evaluated node only when a caller actually supplies a heuristic
+        func h(_ s: BitState) -> Double {
+            if let hf = heuristic { return max(0.0, hf(materialize(s, interned: interned, from: initial))) }
             // Default heuristic: remaining stage distance
-            if g.predicates.contains(Predicate("stage_act")) { return 0 }
-            if g.predicates.contains(Predicate("stage_decide")) { return 1 }
-            if g.predicates.contains(Predicate("stage_analyze")) { return 2 }
+            if s.contains(actId) { return 0 }
+            if s.contains(decideId) { return 1 }
+            if s.contains(analyzeId) { return 2 }
             return 3
         }
 
-        let startKey = start.stateKey()
-        open.append((g: start, gCost: 0.0, fCost: h(start), path: []))
-        best[startKey] = 0.0
+        // A* over tiny state space; use simple arrays for open set
+        typealias Node = (s: BitState, gCost: Double, fCost: Double, path: [Action])
+
+        var open: [Node] = []
+        var best: [BitState: Double] = [:]
+
+        open.append((s: start, gCost: 0.0, fCost: h(start), path: []))
+        best[start] = 0.0
 
         var nodesExpanded = 0
         while !open.isEmpty && nodesExpanded < maxNodes {
@@ -87,20 +137,19 @@ public final class SymbolicReasoningEngine {
             let current = open.remove(at: idx)
             nodesExpanded += 1
 
-            if isGoal(current.g) {
+            if isGoal(current.s) {
                 return Plan(steps: current.path, estimatedCost: current.gCost)
             }
 
             for op in ops {
-                if op.precond(current.g) {
-                    let nextG = op.apply(current.g)
+                if current.s.contains(op.precondBit) {
+                    let nextS = current.s.applying(clearing: op.clearBit, setting: op.setBit)
                     let newCost = current.gCost + op.cost
-                    let key = nextG.stateKey()
-                    if let prev = best[key], prev <= newCost { continue }
-                    best[key] = newCost
-                    let f = newCost + h(nextG)
+                    if let prev = best[nextS], prev <= newCost { continue }
+                    best[nextS] = newCost
+                    let f = newCost + h(nextS)
                     let newPath = current.path + [Action(name: op.name)]
-                    open.append((g: nextG, gCost: newCost, fCost: f, path: newPath))
+                    open.append((s: nextS, gCost: newCost, fCost: f, path: newPath))
                 }
             }
         }
@@ -113,6 +162,19 @@ public final class SymbolicReasoningEngine {
         return Plan(steps: [], estimatedCost: 0.0)
     }
 
+    /// Rebuild a WorldStateGraph from a bitmask state. Objects and relations
+    /// are invariant under the stage operators, so they are carried over from
+    /// the initial graph; only the predicate set is reconstructed.
+    private func materialize(_ s: BitState, interned: [Predicate], from initial: WorldStateGraph) -> WorldStateGraph {
+        let g = WorldStateGraph()
+        for (_, o) in initial.objects { g.upsertObject(o) }
+        for r in initial.relations { g.addRelation(r) }
+        for (bit, p) in interned.enumerated() where s.contains(bit) {
+            g.addPredicate(p)
+        }
+        return g
+    }
+
     /// Optional multi-branch exploration (Tree-of-Thoughts lite)
     public func explore(initial: WorldStateGraph,
                         goalDescription: [Predicate],
@@ -129,31 +191,3 @@ public final class SymbolicReasoningEngine {
         return plans
     }
 }
-
-// MARK: - World helpers
-private extension WorldStateGraph {
-    func copy() -> WorldStateGraph {
-        let g = WorldStateGraph()
-        for (_, o) in self.objects { g.upsertObject(o) }
-        for r in self.relations { g.addRelation(r) }
-        for p in self.predicates { g.addPredicate(p) }
-        return g
-    }
-
-    func stateKey() -> String {
-        let keys = self.predicates.map { $0.name + ($0.arguments.first ?? "") }.sorted()
-        return keys.joined(separator: "|")
-    }
-
-    func ensureStage() -> WorldStateGraph {
-        if self.predicates.contains(Predicate("stage_observe")) ||
-            self.predicates.contains(Predicate("stage_analyze")) ||
-            self.predicates.contains(Predicate("stage_decide")) ||
-            self.predicates.contains(Predicate("stage_act")) {
-            return self
-        }
-        let g = self.copy()
-        g.addPredicate(Predicate("stage_observe"))
-        return g
-    }
-}
@@ -0,0 +1,221 @@
+import Foundation
+
+/// Two-lane event-time scheduler in front of the assessment pipeline.
+///
+/// A large fraction of real traffic is low-priority status chatter —
+/// periodic heartbeats, door-closed confirmations — that only matters if a
+/// pattern emerges. The scheduler splits submissions into two lanes:
+///
+/// - **Priority lane**: anything not classified as low-signal (glass break,
+///   door-open in away mode, motion, …) runs the full pipeline immediately.
+/// - **Deferred lane**: low-signal events park in the `EventChainAnalyzer`
+///   buffer — so chain detection still sees every event — and coalesce into
+///   a single batched assessment per location every `coalesceInterval`
+///   seconds. If parking an event completes or extends a chain pattern, it
+///   is promoted to an immediate assessment on the spot.
+///
+/// This cuts full-pipeline invocations roughly in proportion to the chatter
+/// share while keeping detection quality: every event still feeds the chain
+/// automata, and pattern formation always assesses instantly.
+///
+///     let scheduler = NovinIntelligence.shared.openEventScheduler()
+///     Task { for try await assessment in scheduler.assessments { ... } }
+///     try scheduler.submit(["type": "heartbeat", ...])   // deferred
+///     try scheduler.submit(["type": "glass_break", ...]) // immediate
+///     scheduler.finish()
+@available(iOS 15.0, macOS 12.0, *)
+public final class EventScheduler: @unchecked Sendable {
+
+    /// Event types treated as low-signal chatter by default
+    public static let defaultLowSignalTypes: Set<String> = [
+        "heartbeat", "status", "status_update", "ping", "battery_status",
+        "door_closed", "window_closed", "sensor_check"
+    ]
+
+    private let sdk: NovinIntelligence
+    private let lowSignalTypes: Set<String>
+    private let interval: TimeInterval
+
+    // Deferred lane: newest pending request per location plus how many
+    // events it coalesces; the older ones already live in the chain buffer
+    private let lock = NSLock()
+    private var pending: [String: (latest: SecurityEventRequest, coalesced: Int)] = [:]
+    private var finished = false
+    // Assessment tasks currently running (priority events and flush batches
+    // alike). The stream closes only once finish() was called and this drains,
+    // so shutdown never drops an in-flight assessment.
+    private var inFlight = 0
+    private var streamClosed = false
+
+    private let timerQueue = DispatchQueue(label: "com.novinintelligence.scheduler")
+    private let timer: DispatchSourceTimer
+
+    /// Assessments from both lanes, in completion order. Finishes after
+    /// `finish()` once pending coalesced work and in-flight assessments drain.
+    public let assessments: AsyncThrowingStream<SecurityAssessment, Error>
+    private let out: AsyncThrowingStream<SecurityAssessment, Error>.Continuation
+
+    internal init(sdk: NovinIntelligence, coalesceInterval: TimeInterval, lowSignalTypes: Set<String>) {
+        self.sdk = sdk
+        self.interval = max(0.5, coalesceInterval)
+        self.lowSignalTypes = Set(lowSignalTypes.map { $0.lowercased() })
+
+        var streamContinuation: AsyncThrowingStream<SecurityAssessment, Error>.Continuation!
+        self.assessments = AsyncThrowingStream { streamContinuation = $0 }
+        self.out = streamContinuation
+
+        let timer = DispatchSource.makeTimerSource(queue: timerQueue)
+        timer.schedule(deadline: .now() + self.interval, repeating: self.interval)
+        self.timer = timer
+        timer.setEventHandler { [weak self] in
+            self?.flushDeferred()
+        }
+        timer.resume()
+    }
+
+    // MARK: - Producer API
+
+    /// Submit one event as a parsed dictionary. Validates at the producer and
+    /// routes to the priority or deferred lane by type.
+    /// Throws `InputValidator.ValidationError` for bad input, including
+    /// `rateLimitExceeded` when a priority event is rejected by admission.
+    public func submit(_ event: [String: Any]) throws {
+        try route(InputValidator.validateTypedInput(event))
+    }
+
+    /// Submit one event as a JSON string
+    public func submit(json: String) throws {
+        try route(InputValidator.validateTypedInput(json))
+    }
+
+    /// Stop the scheduler: cancels the coalescing timer, assesses any
+    /// remaining deferred work, then finishes `assessments` once every
+    /// outstanding assessment — timer flushes and priority events included —
+    /// has yielded.
+    public func finish() {
+        lock.lock()
+        if finished {
+            lock.unlock()
+            return
+        }
+        finished = true
+        lock.unlock()
+
+        timer.cancel()
+        // Counts its batch into inFlight before returning, so the drain
+        // check below cannot close the stream underneath it
+        flushDeferred()
+
+        lock.lock()
+        let close = inFlight == 0 && !streamClosed
+        if close { streamClosed = true }
+        lock.unlock()
+        if close { out.finish() }
+    }
+
+    // MARK: - Lane Routing
+
+    private func isLowSignal(_ request: SecurityEventRequest) -> Bool {
+        guard let type = request.type?.lowercased() else { return false }
+        return lowSignalTypes.contains(type)
+    }
+
+    private func route(_ request: SecurityEventRequest) throws {
+        lock.lock()
+        let isFinished = finished
+        lock.unlock()
+        guard !isFinished else { return }
+
+        if !isLowSignal(request) {
+            // Priority lane: full pipeline now. Unlike the bounded event
+            // stream there is no backpressure on this path, so the token
+            // bucket stays engaged — a priority-event storm rejects at the
+            // producer instead of fanning out into unbounded tasks.
+            try sdk.admitPriorityEvent()
+            spawnAssessment(request, chainAlreadyBuffered: false)
+            return
+        }
+
+        // Deferred lane: feed the chain automata immediately so patterns can
+        // form across deferred and priority events alike
+        let pattern = sdk.bufferDeferredEvent(request)
+
+        if pattern != nil {
+            // A chain is forming — promote this event to an immediate
+            // assessment. It is already in the chain buffer, so the pipeline
+            // reads the current pattern instead of inserting twice.
+            lock.lock()
+            pending[request.location ?? "unknown"] = nil
+            lock.unlock()
+            spawnAssessment(request, chainAlreadyBuffered: true)
+            return
+        }
+
+        // Park: the newest event represents its location in the next
+        // coalesced assessment
+        lock.lock()
+        let coalesced = (pending[request.location ?? "unknown"]?.coalesced ?? 0) + 1
+        pending[request.location ?? "unknown"] = (request, coalesced)
+        lock.unlock()
+    }
+
+    /// Run one coalesced assessment per location with pending chatter. The
+    /// batch counts as one tracked task, so a final flush kicked off by
+    /// `finish()` holds the stream open until it has yielded.
+    private func flushDeferred() {
+        lock.lock()
+        let batch = pending
+        pending.removeAll()
+        if !batch.isEmpty { inFlight += 1 }
+        lock.unlock()
+        guard !batch.isEmpty else { return }
+
+        Task { [weak self] in
+            guard let self = self else { return }
+            for (_, entry) in batch {
+                await self.assessAndYield(entry.latest, chainAlreadyBuffered: true)
+            }
+            self.retireTask()
+        }
+    }
+
+    /// Spawn one tracked assessment task. The finished check and the
+    /// in-flight increment share a critical section so a concurrent
+    /// `finish()` either sees the task and waits for it, or the task never
+    /// starts.
+    private func spawnAssessment(_ request: SecurityEventRequest, chainAlreadyBuffered: Bool) {
+        lock.lock()
+        guard !finished else {
+            lock.unlock()
+            return
+        }
+        inFlight += 1
+        lock.unlock()
+
+        Task { [weak self] in
+            guard let self = self else { return }
+            await self.assessAndYield(request, chainAlreadyBuffered: chainAlreadyBuffered)
+            self.retireTask()
+        }
+    }
+
+    /// Retire one tracked task; closes the stream once `finish()` has been
+    /// called and every outstanding assessment has yielded
+    private func retireTask() {
+        lock.lock()
+        inFlight -= 1
+        let close = finished && inFlight == 0 && !streamClosed
+        if close { streamClosed = true }
+        lock.unlock()
+        if close { out.finish() }
+    }
+
+    private func assessAndYield(_ request: SecurityEventRequest, chainAlreadyBuffered: Bool) async {
+        do {
+            let assessment = try await sdk.assessValidated(request, rateLimited: false, chainAlreadyBuffered: chainAlreadyBuffered)
+            out.yield(assessment)
+        } catch {
+            out.yield(with: .failure(error))
+        }
+    }
+}
@@ -0,0 +1,119 @@
+import Foundation
+
+/// Compact capture of everything explanation rendering needs.
+///
+/// The automation layer reads only `threatLevel`/`confidence` for the vast
+/// majority of events; human-readable text is shown only when a user opens a
+/// notification. This token carries the already-computed pipeline outputs
+/// (fused evidence, rule factors, chain pattern, zone, time context) as plain
+/// values, so `assess()` can skip all string interpolation in lazy mode and
+/// `render()` materializes the summary/reasoning/context strings on demand.
+@available(iOS 15.0, macOS 12.0, *)
+public struct ExplanationToken {
+
+    /// Fully materialized explanation strings
+    public struct Rendered {
+        public let reasoning: String
+        public let summary: String
+        public let detailedReasoning: String
+        public let context: [String]
+        public let recommendation: String
+    }
+
+    let threatLevel: ThreatLevel
+    let fused: IntelligentFusion.FusionResult
+    let rules: ReasoningSwift.Result
+    let chainPattern: EventChainAnalyzer.ChainPattern?
+    let motionAnalysis: String?
+    let motionFeatures: MotionAnalyzer.MotionFeatures?
+    let zone: ZoneClassifier.Zone
+    let zoneRiskScore: Double
+    let timeContext: ExplanationEngine.TimeContext
+    let eventType: String
+    let homeMode: String
+    let plan: Plan?
+    let mirror: String?
+    let fuzzyThreat: Double
+    let fuzzyIntent: String
+    let fuzzyRules: [String]
+    let beliefPrev: [String: Double]
+    let beliefNew: [String: Double]
+    // Snapshot of the owning engine's patterns at assessment time, so
+    // rendering stays correct per tenant in multi-context deployments
+    let userPatterns: UserPatterns
+
+    /// Materialize the human-readable explanation. Safe to call from any
+    /// thread; cost is paid only when someone actually reads the text.
+    public func render() -> Rendered {
+        let explanation = ExplanationEngine.explain(
+            threatLevel: threatLevel,
+            chainPattern: chainPattern,
+            motionAnalysis: motionFeatures,
+            zone: zone,
+            timeContext: timeContext,
+            userPatterns: userPatterns,
+            eventType: eventType,
+            homeMode: homeMode
+        )
+        return Rendered(
+            reasoning: buildReasoningTrace(),
+            summary: explanation.summary,
+            detailedReasoning: explanation.reasoning,
+            context: explanation.context,
+            recommendation: explanation.recommendation
+        )
+    }
+
+    /// Legacy pipe-separated reasoning trace (fusion breakdown, chain, zone,
+    /// fuzzy and belief state), previously built inline in assess()
+    private func buildReasoningTrace() -> String {
+        var parts: [String] = []
+        parts.append("Assessment: \(NovinIntelligence.mapScoreToThreatLevel(fused.finalScore).rawValue.uppercased())")
+
+        // Chain pattern
+        if let chain = chainPattern {
+            parts.append("Chain: \(chain.name) (\(chain.reasoning))")
+        }
+
+        // Motion analysis
+        if let motion = motionAnalysis {
+            parts.append("Motion: \(motion)")
+        }
+
+        // Zone risk
+        parts.append("Zone Risk: \(String(format: "%.0f", zoneRiskScore * 100))%")
+
+        // Optional plan steps
+        if let plan = plan, !plan.steps.isEmpty {
+            let stepNames = plan.steps.map { $0.name }.joined(separator: " → ")
+            parts.append("Plan: \(stepNames)")
+        }
+        // Optional mirror summary
+        if let mirror = mirror { parts.append(mirror) }
+
+        // Top math evidence by weight
+        let top = fused.explanation.sorted { $0.weight > $1.weight }.prefix(3)
+        if !top.isEmpty {
+            let desc = top.map { "\($0.name): \($0.present > 0.5 ? "STRONG" : "WEAK")" }.joined(separator: ", ")
+            parts.append("Math: \(desc)")
+        }
+        if !rules.factors.isEmpty {
+            let names = rules.factors.prefix(3)
+            parts.append("Rules: \(names.joined(separator: ", "))")
+        }
+        parts.append("Bayes: \(String(format: "%.0f", fused.bayesianContribution*100))% | Rules: \(String(format: "%.0f", fused.ruleContribution*100))%")
+        parts.append("Confidence: \(String(format: "%.0f", fused.confidence*100))%")
+        parts.append("Final: \(String(format: "%.1f", fused.finalScore*100))% threat probability")
+
+        // Fuzzy and belief trace for transparency (P1)
+        if fuzzyThreat >= 0 {
+            parts.append("Fuzzy: intent=\(fuzzyIntent) threat=\(String(format: "%.2f", fuzzyThreat)) rules=\(fuzzyRules.prefix(2).joined(separator: ","))")
+        }
+        if !beliefNew.isEmpty {
+            func pct(_ x: Double?) -> String { String(format: "%.0f%%", (x ?? 0)*100) }
+            let deltaIntr = (beliefNew["intrusion"] ?? 0) - (beliefPrev["intrusion"] ?? 0)
+            parts.append("Beliefs: deliv=\(pct(beliefNew["delivery"])) intr=\(pct(beliefNew["intrusion"])) (Δ=\(String(format: "%.0f%%", deltaIntr*100))) prowler=\(pct(beliefNew["prowler"])) pet=\(pct(beliefNew["pet"]))")
+        }
+        return parts.joined(separator: " | ")
+    }
+}
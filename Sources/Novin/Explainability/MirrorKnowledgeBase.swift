@@ -0,0 +1,168 @@
+import Foundation
+
+/// Persistent knowledge base for environmental-mirror learning.
+///
+/// Mirror updates used to live in two unbounded in-memory `Set<String>`s
+/// that died with the process — a restart threw away weeks of learned
+/// environment structure and forced the expensive mismatch path all over
+/// again. This store interns predicate names to stable integer IDs and keeps
+/// the learned added/suppressed sets as word-array bitsets, so:
+///
+/// - the per-event predicted-set adjustment is a handful of OR / AND-NOT
+///   word operations plus bit materialization, not per-string set inserts;
+/// - the whole knowledge base serializes compactly (name table + two word
+///   arrays) and survives restarts, loaded at `initialize()`.
+///
+/// Persistence follows the `UserPatterns` convention: JSON in UserDefaults,
+/// on-device and privacy-safe, with writes coalesced behind a short delay.
+/// Per-site context engines keep the store in memory only.
+final class MirrorKnowledgeBase: @unchecked Sendable {
+
+    private struct Snapshot: Codable {
+        let version: Int
+        let names: [String]
+        let added: [UInt64]
+        let suppressed: [UInt64]
+    }
+
+    private static let storageKey = "com.novinintelligence.mirrorknowledge"
+    private static let flushDelay: TimeInterval = 2.0
+
+    private let queue = DispatchQueue(label: "com.novinintelligence.mirrorkb")
+    private let persisted: Bool
+
+    // Interned predicate universe: id → name/Predicate, name → id
+    private var names: [String] = []
+    private var predicatesById: [Predicate] = []
+    private var idsByName: [String: Int] = [:]
+
+    // Learned environment state as bitsets over interned IDs
+    private var added: [UInt64] = []
+    private var suppressed: [UInt64] = []
+
+    private var loaded = false
+    private var flushScheduled = false
+
+    init(persisted: Bool) {
+        self.persisted = persisted
+    }
+
+    // MARK: - Lifecycle
+
+    /// Load the persisted knowledge base (no-op for in-memory stores or when
+    /// already loaded). Called from `initialize()`.
+    func load() {
+        queue.sync {
+            guard persisted, !loaded else { return }
+            loaded = true
+            guard let data = UserDefaults.standard.data(forKey: Self.storageKey),
+                  let snapshot = try? JSONDecoder().decode(Snapshot.self, from: data),
+                  snapshot.version == 1 else { return }
+            names = snapshot.names
+            predicatesById = snapshot.names.map { Predicate($0) }
+            idsByName = Dictionary(uniqueKeysWithValues: snapshot.names.enumerated().map { ($1, $0) })
+            added = snapshot.added
+            suppressed = snapshot.suppressed
+        }
+    }
+
+    /// Clear learned state (for testing)
+    func reset() {
+        queue.sync {
+            names.removeAll()
+            predicatesById.removeAll()
+            idsByName.removeAll()
+            added.removeAll()
+            suppressed.removeAll()
+            if persisted {
+                UserDefaults.standard.removeObject(forKey: Self.storageKey)
+            }
+        }
+    }
+
+    // MARK: - Learning
+
+    /// Record mirror updates: predicates the environment showed we were
+    /// missing, and predictions the environment contradicted. Mutations are
+    /// bit sets over interned IDs; the disk write is coalesced.
+    func learn(added addedNames: [String], suppressed suppressedNames: [String]) {
+        guard !addedNames.isEmpty || !suppressedNames.isEmpty else { return }
+        queue.sync {
+            for name in addedNames {
+                setBit(&added, internLocked(name))
+            }
+            for name in suppressedNames {
+                setBit(&suppressed, internLocked(name))
+            }
+            scheduleFlushLocked()
+        }
+    }
+
+    // MARK: - Prediction
+
+    /// Apply the learned environment to a base predicted set: OR in the
+    /// learned additions, mask out the suppressions, and materialize the
+    /// resulting IDs back to predicates.
+    func predicted(from baseNames: [String]) -> Set<Predicate> {
+        return queue.sync {
+            var baseIds = [Int]()
+            baseIds.reserveCapacity(baseNames.count)
+            for name in baseNames {
+                baseIds.append(internLocked(name))
+            }
+
+            let wordCount = (predicatesById.count + 63) / 64
+            var words = [UInt64](repeating: 0, count: wordCount)
+            for id in baseIds {
+                words[id >> 6] |= 1 << UInt64(id & 63)
+            }
+            for i in 0..<min(wordCount, added.count) {
+                words[i] |= added[i]
+            }
+            for i in 0..<min(wordCount, suppressed.count) {
+                words[i] &= ~suppressed[i]
+            }
+
+            var out = Set<Predicate>(minimumCapacity: baseIds.count + 8)
+            for (w, var bits) in words.enumerated() {
+                while bits != 0 {
+                    let b = bits.trailingZeroBitCount
+                    out.insert(predicatesById[(w << 6) + b])
+                    bits &= bits - 1
+                }
+            }
+            return out
+        }
+    }
+
+    // MARK: - Internals (call on queue)
+
+    private func internLocked(_ name: String) -> Int {
+        if let id = idsByName[name] { return id }
+        let id = names.count
+        names.append(name)
+        predicatesById.append(Predicate(name))
+        idsByName[name] = id
+        return id
+    }
+
+    private func setBit(_ bitset: inout [UInt64], _ id: Int) {
+        let word = id >> 6
+        while bitset.count <= word { bitset.append(0) }
+        bitset[word] |= 1 << UInt64(id & 63)
+    }
+
+    /// Coalesce the UserDefaults write behind a short delay; learning events
+    /// are rare compared to assessments
+    private func scheduleFlushLocked() {
+        guard persisted, !flushScheduled else { return }
+        flushScheduled = true
+        queue.asyncAfter(deadline: .now() + Self.flushDelay) {
+            self.flushScheduled = false
+            let snapshot = Snapshot(version: 1, names: self.names, added: self.added, suppressed: self.suppressed)
+            if let data = try? JSONEncoder().encode(snapshot) {
+                UserDefaults.standard.set(data, forKey: Self.storageKey)
+            }
+        }
+    }
+}
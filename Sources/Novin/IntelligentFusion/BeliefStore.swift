@@ -1,38 +1,115 @@
 import Foundation
 
-// P1: Minimal belief store (deterministic, lightweight)
+// P2: Minimal belief store (deterministic, lightweight, bounded)
 // - Tracks simple hypothesis beliefs per key (e.g., zone or sensor)
 // - Update rule: multiplicative evidence followed by normalization
-// - No decay here (added in P2). No randomness.
+// - Fixed hypothesis slots stored inline (no per-key dictionaries)
+// - Time decay toward the uniform prior, applied lazily when a key is
+//   touched, so idle keys cost nothing between events
+// - LRU-bounded key set so long-lived processes do not accumulate an entry
+//   for every location string ever seen. No randomness.
 struct MinimalBeliefStore {
-    private var store: [String: [String: Double]] = [:]
+
+    /// Inline belief slots in fixed hypothesis order; one of these per key
+    /// replaces the previous per-key `[String: Double]` allocation
+    private struct Beliefs {
+        var delivery: Double = 0.25
+        var intrusion: Double = 0.25
+        var prowler: Double = 0.25
+        var pet: Double = 0.25
+        var lastUpdate: Date
+        var lastTouch: UInt64
+
+        func asDictionary() -> [String: Double] {
+            return ["delivery": delivery, "intrusion": intrusion, "prowler": prowler, "pet": pet]
+        }
+    }
+
+    private var store: [String: Beliefs] = [:]
+    private var touchClock: UInt64 = 0
     private let eps: Double = 1e-9
 
-    mutating func update(key: String, evidence: [String: Double]) -> (prev: [String: Double], next: [String: Double]) {
-        var prev = store[key] ?? defaultBeliefs()
+    /// Maximum number of keys retained; least-recently-touched beyond this
+    /// are evicted
+    private let maxKeys: Int
+
+    /// Beliefs relax halfway back to the uniform prior every `decayHalfLife`
+    /// seconds of inactivity on a key
+    private let decayHalfLife: TimeInterval
+
+    init(maxKeys: Int = 256, decayHalfLife: TimeInterval = 600) {
+        self.maxKeys = maxKeys
+        self.decayHalfLife = decayHalfLife
+    }
+
+    mutating func update(key: String, evidence: [String: Double], now: Date = Date()) -> (prev: [String: Double], next: [String: Double]) {
+        let prev = decayed(beliefs(for: key, now: now), at: now)
         var next = prev
-        // Multiply in evidence likelihoods (clamped), then normalize
+
+        // Multiply in evidence likelihoods (clamped); slots not mentioned in
+        // the evidence keep their prior
         for (hyp, like) in evidence {
             let likelihood = min(1.0, max(eps, like))
-            let prior = prev[hyp] ?? 0.25
-            next[hyp] = max(eps, prior * likelihood)
+            switch hyp {
+            case "delivery": next.delivery = max(eps, prev.delivery * likelihood)
+            case "intrusion": next.intrusion = max(eps, prev.intrusion * likelihood)
+            case "prowler": next.prowler = max(eps, prev.prowler * likelihood)
+            case "pet": next.pet = max(eps, prev.pet * likelihood)
+            default: break
+            }
         }
-        // Ensure all hypotheses exist
-        for hyp in defaultBeliefKeys() where next[hyp] == nil { next[hyp] = eps }
+
         // Normalize to sum = 1
-        let sumVal = max(eps, next.values.reduce(0, +))
-        for (k, v) in next { next[k] = v / sumVal }
+        let sumVal = max(eps, next.delivery + next.intrusion + next.prowler + next.pet)
+        next.delivery /= sumVal
+        next.intrusion /= sumVal
+        next.prowler /= sumVal
+        next.pet /= sumVal
+
+        next.lastUpdate = now
+        touchClock += 1
+        next.lastTouch = touchClock
         store[key] = next
-        return (prev, next)
+        evictIfNeeded()
+
+        return (prev.asDictionary(), next.asDictionary())
+    }
+
+    /// Current beliefs for a key with lazy decay applied (read-only)
+    func beliefs(forKey key: String, now: Date = Date()) -> [String: Double] {
+        guard let b = store[key] else {
+            return ["delivery": 0.25, "intrusion": 0.25, "prowler": 0.25, "pet": 0.25]
+        }
+        return decayed(b, at: now).asDictionary()
     }
 
-    private func defaultBeliefs() -> [String: Double] {
-        var b: [String: Double] = [:]
-        for k in defaultBeliefKeys() { b[k] = 0.25 }
-        return b
+    // MARK: - Internals
+
+    private func beliefs(for key: String, now: Date) -> Beliefs {
+        return store[key] ?? Beliefs(lastUpdate: now, lastTouch: touchClock)
     }
 
-    private func defaultBeliefKeys() -> [String] {
-        return ["delivery", "intrusion", "prowler", "pet"]
+    /// Relax beliefs toward the uniform prior based on time since the last
+    /// update; computed only when the key is actually read
+    private func decayed(_ b: Beliefs, at now: Date) -> Beliefs {
+        let dt = now.timeIntervalSince(b.lastUpdate)
+        guard dt > 0, decayHalfLife > 0 else { return b }
+        let factor = pow(0.5, dt / decayHalfLife)
+        var out = b
+        out.delivery = 0.25 + (b.delivery - 0.25) * factor
+        out.intrusion = 0.25 + (b.intrusion - 0.25) * factor
+        out.prowler = 0.25 + (b.prowler - 0.25) * factor
+        out.pet = 0.25 + (b.pet - 0.25) * factor
+        return out
+    }
+
+    /// Drop the least-recently-touched key once the cap is exceeded.
+    /// Eviction is rare (only on insert past the cap), so a linear scan over
+    /// at most `maxKeys` entries is cheaper than maintaining a linked list.
+    private mutating func evictIfNeeded() {
+        guard store.count > maxKeys else { return }
+        if let victim = store.min(by: { $0.value.lastTouch < $1.value.lastTouch }) {
+            store.removeValue(forKey: victim.key)
+        }
     }
 }
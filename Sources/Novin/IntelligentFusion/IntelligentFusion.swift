@@ -26,8 +26,8 @@ struct IntelligentFusion {
     }
 
     // MARK: - Config
-    private let baseThreatProbability: Double = 0.05
-    private let likelihoods: [String: Likelihood] = [
+    private static let baseThreatProbability: Double = 0.05
+    private static let likelihoods: [String: Likelihood] = [
         // Temporal
         "night": .init(threat: 0.80, noThreat: 0.30, weight: 1.5),
         "weekend": .init(threat: 0.60, noThreat: 0.40, weight: 1.2),
@@ -53,27 +53,80 @@ struct IntelligentFusion {
         "multiple_sensors": .init(threat: 0.85, noThreat: 0.30, weight: 1.4)
     ]
 
+    // MARK: - Compiled fusion table
+    //
+    // The likelihood dictionary above is the spec; the posterior update only
+    // ever needs log(threat/noThreat) * weight per factor. That quantity is
+    // precomputed once into flat arrays indexed by interned factor ID, so
+    // per-event fusion is a dot product over contiguous doubles — no
+    // dictionary walks, divisions or logs on the hot path.
+    private struct CompiledTable {
+        let ids: [String: Int]
+        let names: [String]
+        let weightedLogLR: [Double]
+        let threat: [Double]
+        let noThreat: [Double]
+        let weight: [Double]
+        let priorLogOdds: Double
+    }
+
+    private static let compiled: CompiledTable = {
+        let eps = 1e-9
+        let keys = likelihoods.keys.sorted()
+        var ids: [String: Int] = [:]
+        var weightedLogLR: [Double] = []
+        var threat: [Double] = []
+        var noThreat: [Double] = []
+        var weight: [Double] = []
+        weightedLogLR.reserveCapacity(keys.count)
+        for (index, key) in keys.enumerated() {
+            let lik = likelihoods[key]!
+            ids[key] = index
+            let lr = max(eps, lik.threat / max(eps, lik.noThreat))
+            weightedLogLR.append(log(lr) * lik.weight)
+            threat.append(lik.threat)
+            noThreat.append(lik.noThreat)
+            weight.append(lik.weight)
+        }
+        let prior = log((baseThreatProbability + eps) / max(eps, 1.0 - baseThreatProbability))
+        return CompiledTable(ids: ids, names: keys, weightedLogLR: weightedLogLR,
+                             threat: threat, noThreat: noThreat, weight: weight,
+                             priorLogOdds: prior)
+    }()
+
+    /// Evidence present on one event: parallel arrays of interned factor IDs
+    /// and clamped strengths, ready for the dot-product accumulation
+    private struct Evidence {
+        var factorIds: [Int] = []
+        var strengths: [Double] = []
+        var explanation: [EvidenceFactor] = []
+    }
+
     // MARK: - Public API
     func fuse(features: [String: Double], rules: ReasoningSwift.Result, request: [String: Any]) -> FusionResult {
         let evidence = extractEvidence(from: features, request: request)
         let bayes = bayesianProbability(evidence)
-        let fused = fuseBayesAndRules(bayes: bayes, rules: rules, evidence: evidence)
+        let fused = fuseBayesAndRules(bayes: bayes, rules: rules, evidence: evidence.explanation)
         return FusionResult(
             finalScore: fused.score,
             confidence: fused.confidence,
-            explanation: evidence,
+            explanation: evidence.explanation,
             bayesianContribution: bayes.probability,
             ruleContribution: rules.riskScore
         )
     }
 
     // MARK: - Evidence extraction
-    private func extractEvidence(from features: [String: Double], request: [String: Any]) -> [EvidenceFactor] {
-        var out: [EvidenceFactor] = []
+    private func extractEvidence(from features: [String: Double], request: [String: Any]) -> Evidence {
+        let table = Self.compiled
+        var out = Evidence()
 
         func add(_ key: String, name: String, present: Double = 1.0) {
-            guard let lik = likelihoods[key], present > 0 else { return }
-            out.append(EvidenceFactor(name: name, present: min(max(present, 0), 1), threatLikelihood: lik.threat, noThreatLikelihood: lik.noThreat, weight: lik.weight))
+            guard let id = table.ids[key], present > 0 else { return }
+            let s = min(max(present, 0), 1)
+            out.factorIds.append(id)
+            out.strengths.append(s)
+            out.explanation.append(EvidenceFactor(name: name, present: s, threatLikelihood: table.threat[id], noThreatLikelihood: table.noThreat[id], weight: table.weight[id]))
         }
 
         // Temporal
@@ -123,16 +176,13 @@ struct IntelligentFusion {
     }
 
     // MARK: - Bayesian math
-    private func bayesianProbability(_ evidence: [EvidenceFactor]) -> (probability: Double, logOdds: Double) {
-        // Numerically stable log-odds update
-        let eps = 1e-9
-        var logOdds = log((baseThreatProbability + eps) / max(eps, 1.0 - baseThreatProbability))
-        for e in evidence where e.present > 0.1 {
-            let s = min(max(e.present, 0), 1)
-            // Likelihood ratio for this factor
-            let lr = max(eps, e.threatLikelihood / max(eps, e.noThreatLikelihood))
-            // Scale contribution by evidence strength and factor weight
-            logOdds += log(lr) * (e.weight * s)
+    private func bayesianProbability(_ evidence: Evidence) -> (probability: Double, logOdds: Double) {
+        // Posterior log-odds = prior + Σ strength·(weight·logLR); the factor
+        // term is precompiled, so this is one dot product over present evidence
+        let table = Self.compiled
+        var logOdds = table.priorLogOdds
+        for i in 0..<evidence.factorIds.count where evidence.strengths[i] > 0.1 {
+            logOdds += table.weightedLogLR[evidence.factorIds[i]] * evidence.strengths[i]
         }
         // Convert back to probability
         let prob = 1.0 / (1.0 + exp(-logOdds))
@@ -1,4 +1,5 @@
 import Foundation
+import os
 
 /// System health monitoring for enterprise deployments
 @available(iOS 15.0, macOS 12.0, *)
@@ -12,27 +13,40 @@ public struct SystemHealth: Codable {
     public let totalAssessments: Int
     public let errorCount: Int
     public let averageProcessingTimeMs: Double
+    /// End-to-end latency tail from the histogram (averages hide the tail)
+    public let p50ProcessingTimeMs: Double
+    public let p95ProcessingTimeMs: Double
+    public let p99ProcessingTimeMs: Double
+    public let maxProcessingTimeMs: Double
     public let rateLimit: RateLimitHealth
-    
+    /// Rolling per-stage latency stats keyed by stage label (see StageProfiler)
+    public let stageLatencies: [String: StageLatency]
+
+    public struct StageLatency: Codable {
+        public let count: Int
+        public let meanMs: Double
+        public let p99Ms: Double
+    }
+
     public enum HealthStatus: String, Codable {
         case healthy
         case degraded
         case critical
         case emergency
     }
-    
+
     public struct RateLimitHealth: Codable {
         public let currentTokens: Double
         public let maxTokens: Double
         public let utilizationPercent: Double
     }
-    
+
     /// Get overall health description
     public var description: String {
         """
         System Health: \(status.rawValue.uppercased())
         - Assessments: \(totalAssessments) total, \(errorCount) errors
-        - Performance: \(String(format: "%.1f", averageProcessingTimeMs))ms avg
+        - Performance: \(String(format: "%.1f", averageProcessingTimeMs))ms avg, p50 \(String(format: "%.1f", p50ProcessingTimeMs))ms, p95 \(String(format: "%.1f", p95ProcessingTimeMs))ms, p99 \(String(format: "%.1f", p99ProcessingTimeMs))ms, max \(String(format: "%.1f", maxProcessingTimeMs))ms
         - Rate Limit: \(String(format: "%.0f", rateLimit.utilizationPercent))% utilized
         - Storage: Telemetry \(telemetryStorageBytes) bytes, Patterns \(userPatternsStorageBytes) bytes
         - Uptime: \(String(format: "%.0f", uptime))s
@@ -41,118 +55,229 @@ public struct SystemHealth: Codable {
 }
 
 /// Health monitor singleton
+///
+/// Recording is designed to stay invisible at server event rates: state is
+/// sharded by thread so concurrent pipeline lanes land on different shards,
+/// each protected by its own `os_unfair_lock` — an uncontended acquire is a
+/// couple of atomic ops, and there is no serial queue hop. Latencies go into
+/// a per-shard HDR-style histogram (8 linear sub-buckets per power-of-two
+/// octave over microsecond resolution), so `getHealth` can report
+/// p50/p95/p99/max, not just an average. Shards are merged only at read time.
 @available(iOS 15.0, macOS 12.0, *)
 public final class HealthMonitor: @unchecked Sendable {
     public static let shared = HealthMonitor()
-    
-    private let queue = DispatchQueue(label: "com.novinintelligence.healthmonitor")
+
+    // MARK: - Histogram Layout
+
+    // 8 sub-buckets per octave, 24 octaves: ~1µs to ~16s with ≤12.5% error
+    private static let subBuckets = 8
+    private static let octaves = 24
+    private static let bucketCount = subBuckets * octaves
+
+    /// Bucket index for a latency in milliseconds
+    private static func bucketIndex(forMs ms: Double) -> Int {
+        let us = max(1.0, ms * 1000.0)
+        let octave = min(octaves - 1, max(0, Int(log2(us))))
+        let base = exp2(Double(octave))
+        let sub = min(subBuckets - 1, max(0, Int((us / base - 1.0) * Double(subBuckets))))
+        return octave * subBuckets + sub
+    }
+
+    /// Representative latency (ms) for a bucket — its midpoint
+    private static func bucketValueMs(_ index: Int) -> Double {
+        let octave = index / subBuckets
+        let sub = index % subBuckets
+        let us = exp2(Double(octave)) * (1.0 + (Double(sub) + 0.5) / Double(subBuckets))
+        return us / 1000.0
+    }
+
+    // MARK: - Shards
+
+    /// One shard of monitor state; threads hash onto shards so the unfair
+    /// lock below is effectively uncontended
+    private final class Shard {
+        let lock: UnsafeMutablePointer<os_unfair_lock_s>
+        var totalAssessments: Int = 0
+        var errorCount: Int = 0
+        var sumMs: Double = 0
+        var maxMs: Double = 0
+        var lastAssessmentTime: Date?
+        var histogram = [Int](repeating: 0, count: HealthMonitor.bucketCount)
+
+        init() {
+            lock = UnsafeMutablePointer<os_unfair_lock_s>.allocate(capacity: 1)
+            lock.initialize(to: os_unfair_lock_s())
+        }
+    }
+
+    private let shards: [Shard]
+    private let shardMask: Int
     private var startTime: Date = Date()
-    private var totalAssessments: Int = 0
-    private var errorCount: Int = 0
-    private var processingTimes: [Double] = []
-    private var lastAssessmentTime: Date?
-    private let maxProcessingTimesStored = 100
-    
-    private init() {}
-    
-    /// Record successful assessment
+
+    private init() {
+        // Power-of-two shard count ≥ core count so the mask is a single AND
+        var count = 1
+        while count < ProcessInfo.processInfo.activeProcessorCount { count <<= 1 }
+        count = min(32, max(4, count))
+        shards = (0..<count).map { _ in Shard() }
+        shardMask = count - 1
+    }
+
+    /// Shard for the calling thread
+    private var currentShard: Shard {
+        let tid = Int(pthread_mach_thread_np(pthread_self()))
+        return shards[tid & shardMask]
+    }
+
+    // MARK: - Recording
+
+    /// Record successful assessment (a few uncontended atomic ops)
     public func recordAssessment(processingTimeMs: Double) {
-        queue.async {
-            self.totalAssessments += 1
-            self.lastAssessmentTime = Date()
-            self.processingTimes.append(processingTimeMs)
-            if self.processingTimes.count > self.maxProcessingTimesStored {
-                self.processingTimes.removeFirst()
-            }
-        }
+        let shard = currentShard
+        let bucket = Self.bucketIndex(forMs: processingTimeMs)
+        os_unfair_lock_lock(shard.lock)
+        shard.totalAssessments += 1
+        shard.lastAssessmentTime = Date()
+        shard.sumMs += processingTimeMs
+        if processingTimeMs > shard.maxMs { shard.maxMs = processingTimeMs }
+        shard.histogram[bucket] += 1
+        os_unfair_lock_unlock(shard.lock)
     }
-    
+
     /// Record error
     public func recordError() {
-        queue.async {
-            self.errorCount += 1
-        }
+        let shard = currentShard
+        os_unfair_lock_lock(shard.lock)
+        shard.errorCount += 1
+        os_unfair_lock_unlock(shard.lock)
     }
-    
-    /// Get current system health
+
+    // MARK: - Reporting
+
+    /// Get current system health (merges all shards; read-time cost only)
     public func getHealth(rateLimiter: RateLimiter, queueSize: Int = 0) -> SystemHealth {
-        return queue.sync {
-            let avgProcessingTime = processingTimes.isEmpty ? 0.0 : processingTimes.reduce(0, +) / Double(processingTimes.count)
-            
-            // Calculate storage sizes
-            let telemetrySize = estimateTelemetrySize()
-            let patternsSize = estimateUserPatternsSize()
-            
-            // Determine health status
-            let status = calculateHealthStatus(
-                queueSize: queueSize,
-                errorRate: Double(errorCount) / max(1, Double(totalAssessments)),
-                avgProcessingTime: avgProcessingTime
-            )
-            
-            // Rate limit health
-            let currentTokens = rateLimiter.getCurrentTokens()
-            let rateLimitHealth = SystemHealth.RateLimitHealth(
-                currentTokens: currentTokens,
-                maxTokens: 100,  // From RateLimiter default
-                utilizationPercent: ((100 - currentTokens) / 100) * 100
-            )
-            
-            return SystemHealth(
-                status: status,
-                assessmentQueueSize: queueSize,
-                telemetryStorageBytes: telemetrySize,
-                userPatternsStorageBytes: patternsSize,
-                lastAssessmentTime: lastAssessmentTime,
-                uptime: Date().timeIntervalSince(startTime),
-                totalAssessments: totalAssessments,
-                errorCount: errorCount,
-                averageProcessingTimeMs: avgProcessingTime,
-                rateLimit: rateLimitHealth
-            )
+        var totalAssessments = 0
+        var errorCount = 0
+        var sumMs = 0.0
+        var maxMs = 0.0
+        var lastAssessmentTime: Date?
+        var histogram = [Int](repeating: 0, count: Self.bucketCount)
+
+        for shard in shards {
+            os_unfair_lock_lock(shard.lock)
+            totalAssessments += shard.totalAssessments
+            errorCount += shard.errorCount
+            sumMs += shard.sumMs
+            maxMs = max(maxMs, shard.maxMs)
+            if let t = shard.lastAssessmentTime, lastAssessmentTime.map({ t > $0 }) ?? true {
+                lastAssessmentTime = t
+            }
+            for i in 0..<Self.bucketCount { histogram[i] += shard.histogram[i] }
+            os_unfair_lock_unlock(shard.lock)
         }
+
+        let avgProcessingTime = totalAssessments > 0 ? sumMs / Double(totalAssessments) : 0.0
+        // Bucket midpoints can slightly overshoot the true extreme; clamp to
+        // the exact tracked maximum
+        let cap = maxMs > 0 ? maxMs : Double.greatestFiniteMagnitude
+        let p50 = min(cap, Self.percentile(histogram, total: totalAssessments, 0.50))
+        let p95 = min(cap, Self.percentile(histogram, total: totalAssessments, 0.95))
+        let p99 = min(cap, Self.percentile(histogram, total: totalAssessments, 0.99))
+
+        // Calculate storage sizes
+        let telemetrySize = estimateTelemetrySize()
+        let patternsSize = estimateUserPatternsSize()
+
+        // Determine health status
+        let status = calculateHealthStatus(
+            queueSize: queueSize,
+            errorRate: Double(errorCount) / max(1, Double(totalAssessments)),
+            avgProcessingTime: avgProcessingTime
+        )
+
+        // Rate limit health
+        let currentTokens = rateLimiter.getCurrentTokens()
+        let rateLimitHealth = SystemHealth.RateLimitHealth(
+            currentTokens: currentTokens,
+            maxTokens: 100,  // From RateLimiter default
+            utilizationPercent: ((100 - currentTokens) / 100) * 100
+        )
+
+        return SystemHealth(
+            status: status,
+            assessmentQueueSize: queueSize,
+            telemetryStorageBytes: telemetrySize,
+            userPatternsStorageBytes: patternsSize,
+            lastAssessmentTime: lastAssessmentTime,
+            uptime: Date().timeIntervalSince(startTime),
+            totalAssessments: totalAssessments,
+            errorCount: errorCount,
+            averageProcessingTimeMs: avgProcessingTime,
+            p50ProcessingTimeMs: p50,
+            p95ProcessingTimeMs: p95,
+            p99ProcessingTimeMs: p99,
+            maxProcessingTimeMs: maxMs,
+            rateLimit: rateLimitHealth,
+            stageLatencies: StageProfiler.shared.stats()
+        )
     }
-    
+
+    /// Percentile from the merged histogram (bucket-midpoint estimate)
+    private static func percentile(_ histogram: [Int], total: Int, _ q: Double) -> Double {
+        guard total > 0 else { return 0.0 }
+        let rank = Int(ceil(q * Double(total)))
+        var seen = 0
+        for (i, count) in histogram.enumerated() where count > 0 {
+            seen += count
+            if seen >= rank { return bucketValueMs(i) }
+        }
+        return 0.0
+    }
+
     /// Reset health monitor (for testing)
     public func reset() {
-        queue.sync {
-            startTime = Date()
-            totalAssessments = 0
-            errorCount = 0
-            processingTimes = []
-            lastAssessmentTime = nil
+        for shard in shards {
+            os_unfair_lock_lock(shard.lock)
+            shard.totalAssessments = 0
+            shard.errorCount = 0
+            shard.sumMs = 0
+            shard.maxMs = 0
+            shard.lastAssessmentTime = nil
+            for i in 0..<Self.bucketCount { shard.histogram[i] = 0 }
+            os_unfair_lock_unlock(shard.lock)
         }
+        startTime = Date()
     }
-    
+
     // MARK: - Private Helpers
-    
+
     private func calculateHealthStatus(queueSize: Int, errorRate: Double, avgProcessingTime: Double) -> SystemHealth.HealthStatus {
         // Emergency: Critical failures
         if errorRate > 0.5 {
             return .emergency
         }
-        
+
         // Critical: High error rate or severe performance degradation
         if errorRate > 0.2 || avgProcessingTime > 500 {
             return .critical
         }
-        
+
         // Degraded: Moderate issues
         if errorRate > 0.05 || avgProcessingTime > 100 || queueSize > 50 {
             return .degraded
         }
-        
+
         // Healthy: All good
         return .healthy
     }
-    
+
     private func estimateTelemetrySize() -> Int {
         // Estimate based on telemetry metrics
         let metrics = TemporalTelemetry.shared.getMetrics()
         // Rough estimate: 200 bytes per event
         return metrics.totalEvents * 200
     }
-    
+
     private func estimateUserPatternsSize() -> Int {
         // Estimate based on user patterns - use dummy size since we can't access private static
         // This is just for health monitoring estimation anyway
@@ -21,7 +21,6 @@ public final class NovinIntelligence: @unchecked Sendable {
     private let fusionEngine = IntelligentFusion()
     // Phase 2: FEAR-Chain components (lightweight, deterministic)
     private let fearHeuristic = FearHeuristic()
-    private let normalityTracker = NormalityTracker()
     private var safetyAdjustment: Double = 0.0 // FEAR-Chain adjustment (0.0 - 1.0)
     // Phase 3: Symbolic planner components (training-free)
     private let symbolicPlanner = SymbolicReasoningEngine()
@@ -31,49 +30,130 @@ public final class NovinIntelligence: @unchecked Sendable {
     private let environmentalMirror = EnvironmentalMirror()
     private let symbolicUpdater = SymbolicUpdater()
     private var applyMirrorUpdates: Bool = false
-    private var mirrorAddedPredicates: Set<String> = []
-    private var mirrorSuppressedPredicates: Set<String> = []
+    // Learned-environment store: interned predicate IDs with persisted
+    // added/suppressed bitsets, so mirror learning survives restarts
+    private lazy var mirrorKnowledge = MirrorKnowledgeBase(persisted: self.persistsUserPatterns)
 
     // MARK: - Enterprise Components
     private let rateLimiter = RateLimiter(maxTokens: 100, refillRate: 100)
-    private let eventChainAnalyzer = EventChainAnalyzer()
     private let zoneClassifier = ZoneClassifier()
-    // P1: Minimal belief store (progressive reasoning, lightweight, deterministic)
-    private var beliefStore = MinimalBeliefStore()
-    
+    // Audit sink: the shared engine records through the process-wide
+    // persistent manager; context engines hold their own in-memory manager so
+    // tenant trails stay isolated and never reach the shared on-disk log
+    private lazy var auditTrails: AuditTrailManager =
+        persistsUserPatterns ? .shared : AuditTrailManager(persistent: false)
+
+    // MARK: - Execution Lanes
+
+    /// Order-sensitive pipeline state for one execution lane.
+    ///
+    /// Chain analysis, belief accumulation, and normality statistics must see a
+    /// location's events in order, so each lane owns its own instances and a
+    /// location is always pinned to the same lane by a stable hash of its key.
+    /// Stateless components (feature extraction, rules, fusion, zones) are
+    /// shared read-only across all lanes.
+    private final class AssessmentLane {
+        let queue: DispatchQueue
+        let eventChainAnalyzer = EventChainAnalyzer()
+        let normalityTracker = NormalityTracker()
+        // P1: Minimal belief store (progressive reasoning, lightweight, deterministic)
+        var beliefStore = MinimalBeliefStore()
+
+        init(queue: DispatchQueue) {
+            self.queue = queue
+        }
+    }
+
+    /// Default serial lane; backs all processing unless concurrency is enabled
+    private lazy var primaryLane = AssessmentLane(queue: processingQueue)
+    private var lanes: [AssessmentLane] = []
+    private var concurrentExecutionEnabled = false
+    // Skip explanation string building on the hot path (see setLazyExplanations)
+    private var lazyExplanationsEnabled = false
+    // Audit record detail for benign traffic (see setAuditDetail)
+    private var auditDetailPolicy: AuditDetailPolicy = .full
+    // Opt-in duplicate suppression (see setDuplicateMemoCache)
+    private var memoCache: AssessmentMemoCache?
+
     // MARK: - Version
     public static let sdkVersion = "2.0.0-enterprise"
-    
-    private init() {}
-    
+
+    /// Internal so `NovinIntelligenceContext` can stand up per-site engines.
+    /// App deployments keep using `shared`; server deployments hold one engine
+    /// per tenant. Context engines skip disk-backed pattern persistence —
+    /// thousands of tenants must not contend on one patterns file.
+    internal init(persistsUserPatterns: Bool = true) {
+        self.persistsUserPatterns = persistsUserPatterns
+        self.userPatterns = persistsUserPatterns ? UserPatterns.load() : UserPatterns()
+    }
+
     // MARK: - Enterprise Configuration API
-    
-    // Private static storage for enterprise config (accessed via instance methods)
-    private static var sharedTemporalConfig: TemporalConfiguration = .default
-    private static var sharedUserPatterns: UserPatterns = UserPatterns.load()
-    
+
+    // Per-engine config and learned patterns. Each engine (the app singleton
+    // or a server-side per-site context) owns its own copies so tenants never
+    // see each other's thresholds or feedback.
+    private var temporalConfig: TemporalConfiguration = .default
+    private var userPatterns: UserPatterns
+    private let persistsUserPatterns: Bool
+
+    // Write-behind persistence for user patterns: feedback mutations apply in
+    // memory immediately and disk writes coalesce behind a short delay or a
+    // mutation count, so syncing a backlog of hundreds of dismissals costs a
+    // handful of writes instead of one write per event. The flush queue is
+    // shared — only persisting engines touch it.
+    private static let patternsFlushQueue = DispatchQueue(label: "com.novinintelligence.patternsflush")
+    private var pendingPatternMutations: Int = 0
+    private var patternsFlushScheduled = false
+    private static let patternsFlushDelay: TimeInterval = 2.0
+    private static let patternsFlushMutationLimit = 100
+
+    /// Coalesce a pattern write: flush after a short delay, or immediately
+    /// once enough mutations have piled up. Call after any pattern mutation.
+    private func schedulePatternsFlush() {
+        guard persistsUserPatterns else { return }
+        Self.patternsFlushQueue.async {
+            self.pendingPatternMutations += 1
+            if self.pendingPatternMutations >= Self.patternsFlushMutationLimit {
+                self.flushPatternsLocked()
+                return
+            }
+            guard !self.patternsFlushScheduled else { return }
+            self.patternsFlushScheduled = true
+            Self.patternsFlushQueue.asyncAfter(deadline: .now() + Self.patternsFlushDelay) {
+                self.flushPatternsLocked()
+            }
+        }
+    }
+
+    /// Persist patterns and clear pending state. Call on patternsFlushQueue.
+    private func flushPatternsLocked() {
+        pendingPatternMutations = 0
+        patternsFlushScheduled = false
+        try? userPatterns.save()
+    }
+
     /// Configure temporal intelligence settings
     /// - Parameter config: Temporal configuration (default, aggressive, or conservative)
     public func configure(temporal config: TemporalConfiguration) throws {
         try config.validate()
-        Self.sharedTemporalConfig = config
+        temporalConfig = config
     }
-    
+
     /// Get current temporal configuration
     public func getTemporalConfiguration() -> TemporalConfiguration {
-        return Self.sharedTemporalConfig
+        return temporalConfig
     }
-    
+
     /// Get user patterns
     internal func getUserPatterns() -> UserPatterns {
-        return Self.sharedUserPatterns
+        return userPatterns
     }
-    
+
     /// Set user patterns
     internal func setUserPatterns(_ patterns: UserPatterns) {
-        Self.sharedUserPatterns = patterns
+        userPatterns = patterns
     }
-    
+
     /// Provide user feedback for pattern learning (validated)
     /// - Parameters:
     ///   - eventType: Type of event (e.g., "doorbell_motion")
@@ -81,37 +161,47 @@ public final class NovinIntelligence: @unchecked Sendable {
     public func provideFeedback(eventType: String, wasFalsePositive: Bool) {
         // Only allow in full or degraded mode
         guard currentMode.isFeatureAvailable(.userPatternLearning) else { return }
-        
+
         // Validate event type is reasonable
         guard eventType.count <= 100, !eventType.isEmpty else { return }
-        
-        var patterns = Self.sharedUserPatterns
+
+        var patterns = userPatterns
         patterns.learn(eventType: eventType, wasFalsePositive: wasFalsePositive)
-        try? patterns.save()
-        Self.sharedUserPatterns = patterns
+        userPatterns = patterns
+        // Write-behind: in-memory state is current; disk write is coalesced
+        schedulePatternsFlush()
+    }
+
+    /// Flush any pending user-pattern writes to disk immediately.
+    /// Call on app-background transitions to keep clean-shutdown durability.
+    public func flushUserPatterns() {
+        guard persistsUserPatterns else { return }
+        Self.patternsFlushQueue.sync {
+            self.flushPatternsLocked()
+        }
     }
-    
+
     /// Get user pattern insights
     public func getUserPatternInsights() -> DeliveryPatternInsights {
-        return Self.sharedUserPatterns.getDeliveryPatternInsights()
+        return userPatterns.getDeliveryPatternInsights()
     }
-    
+
     /// Get telemetry metrics (privacy-safe)
     public func getTelemetryMetrics() -> DampeningMetrics {
         return TemporalTelemetry.shared.getMetrics()
     }
-    
+
     /// Export telemetry as JSON
     public func exportTelemetry() -> String? {
         return TemporalTelemetry.shared.exportMetrics()
     }
-    
+
     /// Reset user patterns (for testing or user request)
     public func resetUserPatterns() {
-        var patterns = Self.sharedUserPatterns
+        var patterns = userPatterns
         patterns.reset()
-        try? patterns.save()
-        Self.sharedUserPatterns = patterns
+        if persistsUserPatterns { try? patterns.save() }
+        userPatterns = patterns
     }
 
     // MARK: - Training-free Reasoning Configuration (Feature Flags)
@@ -130,47 +220,126 @@ public final class NovinIntelligence: @unchecked Sendable {
 
     /// Get current reasoning feature flags
     public func getReasoningConfig() -> ReasoningConfig { reasoningConfig }
-    
+
     // MARK: - Enterprise Health & Monitoring
-    
+
     /// Get current system health
     public func getSystemHealth() -> SystemHealth {
         return HealthMonitor.shared.getHealth(rateLimiter: rateLimiter)
     }
-    
+
     /// Get current SDK operational mode
     public func getCurrentMode() -> SDKMode {
         return currentMode
     }
-    
+
     /// Set SDK operational mode (for testing or degraded operation)
     public func setMode(_ mode: SDKMode) {
         currentMode = mode
         Logger(subsystem: "com.novinintelligence", category: "mode").info("SDK mode changed to: \(mode.rawValue)")
     }
-    
+
+    /// Enable concurrent assessment execution across multiple worker lanes.
+    ///
+    /// Events are routed to a lane by a stable hash of their location key, so
+    /// all events for one location stay strictly ordered while independent
+    /// locations run in parallel across cores. Pass `enabled: false` to return
+    /// to fully serial processing on the primary queue.
+    /// - Parameters:
+    ///   - enabled: Turn concurrent execution on or off
+    ///   - parallelism: Number of worker lanes (default: active core count)
+    public func setConcurrentExecution(enabled: Bool, parallelism: Int = ProcessInfo.processInfo.activeProcessorCount) {
+        processingQueue.sync {
+            if enabled {
+                let laneCount = max(2, min(32, parallelism))
+                self.lanes = (0..<laneCount).map { index in
+                    AssessmentLane(queue: DispatchQueue(label: "com.novinintelligence.processing.lane\(index)", qos: .userInitiated))
+                }
+            } else {
+                self.lanes = []
+            }
+            self.concurrentExecutionEnabled = enabled && !self.lanes.isEmpty
+        }
+        Logger(subsystem: "com.novinintelligence", category: "config").info("Concurrent execution \(enabled ? "enabled" : "disabled") with \(self.lanes.count) lanes")
+    }
+
+    /// Defer human-readable explanation generation.
+    ///
+    /// When enabled, assessments skip all summary/reasoning string building on
+    /// the hot path and instead carry an `explanationToken`; call
+    /// `assessment.renderExplanation()` when text is actually shown to a user.
+    /// Automation consumers that only read `threatLevel`/`confidence` pay
+    /// nothing for explanations.
+    public func setLazyExplanations(enabled: Bool) {
+        processingQueue.sync {
+            self.lazyExplanationsEnabled = enabled
+        }
+        Logger(subsystem: "com.novinintelligence", category: "config").info("Lazy explanations \(enabled ? "enabled" : "disabled")")
+    }
+
+    /// Enable or disable the duplicate-assessment memo cache.
+    ///
+    /// Ingestion retries and double-delivering hubs produce byte-identical
+    /// events within seconds; with the cache enabled, an exact duplicate
+    /// returns the cached decision (fresh requestId and timestamp, cached
+    /// reasoning) without re-running the pipeline — so chain analysis,
+    /// beliefs, and normality statistics never double-update. Duplicates are
+    /// still counted in HealthMonitor. Off by default.
+    /// - Parameters:
+    ///   - enabled: Turn duplicate suppression on or off
+    ///   - ttl: How long a cached decision stays valid (default: 3 seconds)
+    public func setDuplicateMemoCache(enabled: Bool, ttl: TimeInterval = 3.0) {
+        processingQueue.sync {
+            self.memoCache = enabled ? AssessmentMemoCache(ttl: ttl) : nil
+        }
+        Logger(subsystem: "com.novinintelligence", category: "config").info("Duplicate memo cache \(enabled ? "enabled" : "disabled") (ttl: \(ttl)s)")
+    }
+
+    /// Set the audit recording detail policy.
+    ///
+    /// With `.tiered`, low-threat events record only a minimal trail (id,
+    /// input hash, level, score, time) instead of the full intermediate
+    /// breakdown — the bulk of traffic lands at `.low` and its audit write is
+    /// pure overhead. Elevated/critical events always get the full trail, and
+    /// the sample rate keeps a fraction of low-threat events at full detail.
+    public func setAuditDetail(_ policy: AuditDetailPolicy) {
+        processingQueue.sync {
+            self.auditDetailPolicy = policy
+        }
+        Logger(subsystem: "com.novinintelligence", category: "config").info("Audit detail policy updated")
+    }
+
     /// Get audit trail for request
     public func getAuditTrail(requestId: UUID) -> AuditTrail? {
-        return AuditTrailManager.shared.getTrail(requestId: requestId)
+        return auditTrails.getTrail(requestId: requestId)
     }
-    
+
     /// Get recent audit trails
     public func getRecentAuditTrails(limit: Int = 100) -> [AuditTrail] {
-        return AuditTrailManager.shared.getRecentTrails(limit: limit)
+        return auditTrails.getRecentTrails(limit: limit)
     }
-    
+
     /// Export all audit trails as JSON
     public func exportAuditTrails() -> String? {
-        return AuditTrailManager.shared.exportAllTrails()
+        return auditTrails.exportAllTrails()
     }
-    
+
     /// Reset rate limiter (for testing)
     public func resetRateLimiter() {
         rateLimiter.reset()
     }
-    
+
     // MARK: - Initialization
-    
+
+    /// Rules are compiled once per process and shared by every engine via
+    /// copy-on-write — a per-site context pays a struct copy, not a bundle
+    /// load, and thousands of tenants reference the same rule arrays.
+    private static let compiledRules: (engine: ReasoningSwift, count: Int) = {
+        var engine = ReasoningSwift()
+        let count = engine.loadRules()
+        return (engine, count)
+    }()
+
     /// Initialize the NovinIntelligence SDK with enterprise features
     /// - Parameter brandConfig: Optional brand-specific configuration
     public func initialize(brandConfig: String? = nil) async throws {
@@ -178,10 +347,9 @@ public final class NovinIntelligence: @unchecked Sendable {
         return try await withCheckedThrowingContinuation { continuation in
             processingQueue.async {
                 do {
-                    // Load rules from bundled JSON (or fallback)
-                    var engine = self.reasoningEngine
-                    let count = engine.loadRules()
-                    self.reasoningEngine = engine
+                    // Adopt the process-wide compiled rules (or fallback)
+                    let count = Self.compiledRules.count
+                    self.reasoningEngine = Self.compiledRules.engine
 
                     // Perform a lightweight feature extraction sanity check
                     let sanity = self.featureExtractor.extractNamedFeatures(from: [:])
@@ -190,11 +358,16 @@ public final class NovinIntelligence: @unchecked Sendable {
                         self.currentMode = .minimal
                         Logger(subsystem: "com.novinintelligence", category: "init").warning("Feature extraction failed, entering minimal mode")
                     }
-                    
+
                     // Load user patterns (graceful degradation if fails)
                     // Note: UserPatterns.load() doesn't throw, but we wrap for future-proofing
-                    Self.sharedUserPatterns = UserPatterns.load()
-                    
+                    if self.persistsUserPatterns {
+                        self.userPatterns = UserPatterns.load()
+                    }
+
+                    // Restore learned environment structure for the mirror
+                    self.mirrorKnowledge.load()
+
                     self.isInitialized = true
                     Logger(subsystem: "com.novinintelligence", category: "init").info("✅ SDK v\(Self.sdkVersion) initialized with \(count) rules, mode: \(self.currentMode.rawValue)")
                     continuation.resume(returning: ())
@@ -204,378 +377,220 @@ public final class NovinIntelligence: @unchecked Sendable {
             }
         }
     }
-    
+
+    /// Synchronous bootstrap for per-site context engines: adopt the shared
+    /// compiled rules and mark ready. No bundle or disk I/O, so creating a
+    /// context is cheap enough to do once per tenant at connection time.
+    internal func bootstrapContextEngine() {
+        processingQueue.sync {
+            guard !self.isInitialized else { return }
+            self.reasoningEngine = Self.compiledRules.engine
+            self.isInitialized = true
+        }
+    }
+
     // MARK: - Main API
-    
+
     /// Process security event and return threat assessment with enterprise AI
     public func assess(requestJson: String) async throws -> SecurityAssessment {
         guard isInitialized else { throw NovinIntelligenceError.notInitialized }
-        
+
         // P0.2: Rate limiting
         guard rateLimiter.allow() else {
             HealthMonitor.shared.recordError()
             throw InputValidator.ValidationError.rateLimitExceeded
         }
-        
+
+        if concurrentExecutionEnabled {
+            return try await assessConcurrent(requestJson: requestJson)
+        }
+
         return try await withCheckedThrowingContinuation { continuation in
             processingQueue.async {
-                let start = Date()
-                let requestId = UUID()
-                
                 do {
-                    // P0.1: Input validation
-                    let request = try InputValidator.validateInput(requestJson)
-                    
-                    // Emergency mode: Return safe default
-                    if self.currentMode == .emergency {
-                        let assessment = SecurityAssessment(
-                            threatLevel: .standard,
-                            confidence: 0.5,
-                            processingTimeMs: Date().timeIntervalSince(start) * 1000.0,
-                            reasoning: "Emergency mode: Safe fallback response",
-                            requestId: requestId.uuidString,
-                            timestamp: ISO8601DateFormatter().string(from: Date())
-                        )
-                        continuation.resume(returning: assessment)
-                        return
-                    }
-                    
-                    // P1.1: Event chain analysis
-                    var chainPattern: EventChainAnalyzer.ChainPattern?
-                    var chainAdjustment: Double = 0.0
-                    if let eventType = request["type"] as? String,
-                       let timestamp = request["timestamp"] as? Double,
-                       let metadata = request["metadata"] as? [String: Any],
-                       let locationStr = metadata["location"] as? String {
-                        let event = EventChainAnalyzer.SecurityEvent(
-                            type: eventType,
-                            timestamp: Date(timeIntervalSince1970: timestamp),
-                            location: locationStr,
-                            confidence: request["confidence"] as? Double ?? 0.5,
-                            metadata: request
-                        )
-                        chainPattern = self.eventChainAnalyzer.analyzeChain(event)
-                        chainAdjustment = chainPattern?.threatDelta ?? 0.0
-                    }
-                    
-                    // P1.3: Zone classification
-                    var zoneRiskScore: Double = 0.5
-                    if let metadata = request["metadata"] as? [String: Any],
-                       let location = metadata["location"] as? String {
-                        zoneRiskScore = self.zoneClassifier.getRiskScore(for: location)
-                    }
-                    
-                    // 1) Extract named features
-                    var features = self.featureExtractor.extractNamedFeatures(from: request)
-                    
-                    // P1.2: Motion analysis (if motion event)
-                    var motionAnalysis: String?
-                    var motionFeatures: MotionAnalyzer.MotionFeatures?
-                    // Fuzzy + beliefs (P1)
-                    var fuzzyThreat: Double = -1
-                    var fuzzyIntent: String = ""
-                    var fuzzyIntentScores: [String: Double] = [:]
-                    var fuzzyRules: [String] = []
-                    var beliefPrev: [String: Double] = [:]
-                    var beliefNew: [String: Double] = [:]
-                    if let metadata = request["metadata"] as? [String: Any],
-                       (request["type"] as? String)?.contains("motion") == true {
-                        let analyzed = MotionAnalyzer.analyzeFromMetadata(metadata)
-                        motionFeatures = analyzed
-                        motionAnalysis = "\(analyzed.activityType.rawValue) (\(String(format: "%.0f", analyzed.confidence * 100))%)"
-                        
-                        // Adjust features based on motion analysis
-                        if analyzed.activityType == .package_drop {
-                            features["event_motion"] = (features["event_motion"] ?? 1.0) * 0.6
-                        } else if analyzed.activityType == .loitering {
-                            features["event_motion"] = (features["event_motion"] ?? 1.0) * 1.3
-                        }
+                    // P0.1: Input validation (single parse into typed request)
+                    let request = try StageProfiler.shared.measure(.validation) { try InputValidator.validateTypedInput(requestJson) }
+                    let context = PipelineContext(temporalConfig: self.getTemporalConfiguration())
+                    let assessment = try self.performAssessment(request: request, requestId: UUID(), start: Date(), context: context, lane: self.primaryLane)
+                    continuation.resume(returning: assessment)
+                } catch {
+                    // P0.3: Record error in health monitor
+                    HealthMonitor.shared.recordError()
+                    continuation.resume(throwing: error)
+                }
+            }
+        }
+    }
 
-                        // Fuzzy micro-kernel (duration/energy from metadata if present)
-                        let duration = analyzed.duration
-                        let energy = analyzed.energy
-                        // Home mode + activity hint
-                        let homeMode = (metadata["home_mode"] as? String) ?? "home"
-                        let activityHint = (metadata["activity"] as? String)
-                        // Event hour from event timestamp (P1: use event timestamp, not wall clock)
-                        let cfg = self.getTemporalConfiguration()
-                        var cal = Calendar(identifier: .gregorian)
-                        cal.timeZone = cfg.timezone
-                        let eventTs = (request["timestamp"] as? Double) ?? Date().timeIntervalSince1970
-                        let eventHour = cal.component(.hour, from: Date(timeIntervalSince1970: eventTs))
-
-                        let fuzzy = MotionAnalyzer.fuzzyAssess(
-                            duration: duration,
-                            energy: energy,
-                            zoneRisk: zoneRiskScore,
-                            eventHour: eventHour,
-                            homeMode: homeMode,
-                            activityHint: activityHint
-                        )
-                        fuzzyThreat = fuzzy.threat
-                        fuzzyIntent = fuzzy.intent
-                        fuzzyIntentScores = fuzzy.intentScores
-                        fuzzyRules = fuzzy.rules
-
-                        // Minimal belief update (P1): accumulate evidence across events
-                        // Map fuzzy intents to hypotheses and add chain/intrusion signal if present later
-                        var evidence: [String: Double] = [:]
-                        evidence["delivery"] = fuzzyIntentScores["delivery"] ?? 0.0
-                        evidence["prowler"] = fuzzyIntentScores["prowler"] ?? 0.0
-                        evidence["pet"] = fuzzyIntentScores["pet"] ?? 0.0
-                        // intrusion evidence will be finalized after chain pattern detection below
-                        // For now, seed with fraction of prowler likelihood
-                        evidence["intrusion"] = max(0.0, (fuzzyIntentScores["prowler"] ?? 0.0) * 0.5)
-
-                        let key = (metadata["location"] as? String) ?? "unknown"
-                        let update = self.beliefStore.update(key: key, evidence: evidence)
-                        beliefPrev = update.prev
-                        beliefNew = update.next
-                    }
-                    
-                    // Inject zone risk into features
-                    features["zone_risk"] = zoneRiskScore
-                    
-                    // 2) Rule reasoning (skip in minimal mode)
-                    var ruleResult: ReasoningSwift.Result
-                    if self.currentMode == .minimal {
-                        ruleResult = ReasoningSwift.Result(
-                            assessment: "minimal_mode",
-                            confidence: 0.5,
-                            chain: [],
-                            factors: [],
-                            recommendations: [],
-                            riskScore: 0.5
-                        )
-                    } else {
-                        ruleResult = self.reasoningEngine.reason(request: request, features: features)
-                    }
-                    
-                    // 3) Mathematical fusion (skip in minimal mode)
-                    var fused: IntelligentFusion.FusionResult
-                    if self.currentMode == .minimal {
-                        fused = IntelligentFusion.FusionResult(
-                            finalScore: ruleResult.riskScore,
-                            confidence: ruleResult.confidence,
-                            explanation: [],
-                            bayesianContribution: 0.0,
-                            ruleContribution: 1.0
-                        )
-                    } else {
-                        fused = self.fusionEngine.fuse(features: features, rules: ruleResult, request: request)
-                    }
-                    
-                    // 4) Apply chain pattern adjustment
-                    var finalScore = fused.finalScore + chainAdjustment
-
-                    // 4.1) FEAR-Chain safety adjustment (training-free, lightweight)
-                    var fearScore: Double = 0.0
-                    var normality: Double = 0.0
-                    var safetyAdjustmentVal: Double = 0.0
-                    if self.reasoningConfig.enableFearChain {
-                        fearScore = self.fearHeuristic.score(features: features)
-                        // Compute normality against running mean BEFORE update
-                        normality = self.normalityTracker.score(features: features)
-                        // Update statistics for next observations (online, no training)
-                        self.normalityTracker.update(features: features)
-                        // Conservative weights: amplify threat slightly, dampen by normality
-                        let alpha = 0.15
-                        let beta = 0.10
-                        safetyAdjustmentVal = alpha * fearScore - beta * normality
-                        finalScore += safetyAdjustmentVal
-                    }
+    /// Concurrent path: validate on the caller (validation is pure and
+    /// thread-safe) to learn the routing key, then run the pipeline on the
+    /// lane that owns this location.
+    private func assessConcurrent(requestJson: String) async throws -> SecurityAssessment {
+        let request: SecurityEventRequest
+        do {
+            request = try StageProfiler.shared.measure(.validation) { try InputValidator.validateTypedInput(requestJson) }
+        } catch {
+            HealthMonitor.shared.recordError()
+            throw error
+        }
+        let lane = routingLane(for: request.location ?? "unknown")
 
-                    // Pet-in-home dampening (P1)
-                    if let metadata = request["metadata"] as? [String: Any] {
-                        let homeMode = (metadata["home_mode"] as? String) ?? "home"
-                        if homeMode == "home" {
-                            // If fuzzy intent is pet with meaningful weight, dampen
-                            let petWeight = fuzzyIntentScores["pet"] ?? 0.0
-                            if petWeight > 0.4 {
-                                let cfg = self.getTemporalConfiguration()
-                                finalScore = finalScore * (1.0 - min(1.0, max(0.0, cfg.petDampeningFactor)))
-                            }
-                        }
-                    }
+        return try await withCheckedThrowingContinuation { continuation in
+            lane.queue.async {
+                do {
+                    let context = PipelineContext(temporalConfig: self.getTemporalConfiguration())
+                    let assessment = try self.performAssessment(request: request, requestId: UUID(), start: Date(), context: context, lane: lane)
+                    continuation.resume(returning: assessment)
+                } catch {
+                    HealthMonitor.shared.recordError()
+                    continuation.resume(throwing: error)
+                }
+            }
+        }
+    }
 
-                    finalScore = max(0.0, min(1.0, finalScore))
-                    
-                    // 5) Optional symbolic planning (training-free, behind flags)
-                    var combinedPlan: Plan? = nil
-                    if self.reasoningConfig.enableSymbolicPlanner || self.reasoningConfig.enableAffordancePlanner {
-                        // Build initial world from features via translator
-                        let preds = self.symbolicTranslator.translate(features: features, request: request)
-                        let world = WorldStateGraph()
-                        for p in preds { world.addPredicate(p) }
-
-                        var steps: [Action] = []
-                        if self.reasoningConfig.enableAffordancePlanner {
-                            let metadata = request["metadata"] as? [String: Any]
-                            let ap = self.affordancePlanner.suggest(features: features, metadata: metadata)
-                            steps.append(contentsOf: ap.steps)
-                        }
-                        if self.reasoningConfig.enableSymbolicPlanner {
-                            let sp = self.symbolicPlanner.plan(initial: world, goalDescription: [Predicate("stage_act")], maxNodes: 128)
-                            steps.append(contentsOf: sp.steps)
-                        }
-                        combinedPlan = Plan(steps: steps, estimatedCost: Double(steps.count))
+    /// Stable lane routing: same location key always maps to the same lane
+    /// within a process so order-sensitive state never splits across lanes.
+    ///
+    /// Resolves against a single snapshot of the lane table. A concurrent
+    /// `setConcurrentExecution(enabled: false)` may clear the table while a
+    /// request is mid-routing; landing on the primary lane in that window is
+    /// acceptable (same tolerance as the stale-flag read), but the hash must
+    /// never index with a lane count it did not snapshot.
+    private func routingLane(for location: String) -> AssessmentLane {
+        let snapshot = lanes
+        guard concurrentExecutionEnabled, !snapshot.isEmpty else { return primaryLane }
+        var hash: UInt64 = 1469598103934665603  // FNV-1a 64-bit offset basis
+        for byte in location.utf8 {
+            hash ^= UInt64(byte)
+            hash = hash &* 1099511628211
+        }
+        return snapshot[Int(hash % UInt64(snapshot.count))]
+    }
+
+    /// Process a burst of correlated security events in one pipeline entry.
+    ///
+    /// Validation happens up front and the queue hop, temporal config snapshot,
+    /// calendar, and timestamp formatter are paid once for the whole batch instead
+    /// of once per event, so a multi-camera burst of 20-50 events costs far less
+    /// than the same number of independent `assess` calls. Events are processed
+    /// in order, so chain analysis and belief updates behave exactly as they
+    /// would with sequential calls. With concurrent execution enabled, each
+    /// event runs on the lane that owns its location — the same routing as
+    /// `assess` — so per-location ordering and state stay consistent across
+    /// batch and single-event calls.
+    public func assessBatch(_ requests: [String]) async throws -> [SecurityAssessment] {
+        guard isInitialized else { throw NovinIntelligenceError.notInitialized }
+
+        // P0.2: Rate limit the batch by its size so bursts cannot bypass admission
+        guard rateLimiter.allow(cost: Double(max(1, requests.count))) else {
+            HealthMonitor.shared.recordError()
+            throw InputValidator.ValidationError.rateLimitExceeded
+        }
+
+        if concurrentExecutionEnabled {
+            return try await assessBatchConcurrent(requests)
+        }
+
+        return try await withCheckedThrowingContinuation { continuation in
+            processingQueue.async {
+                do {
+                    // Validate every event before touching stateful components
+                    // (chain buffer, beliefs) so a malformed entry fails fast
+                    let validated = try StageProfiler.shared.measure(.validation) { try requests.map { try InputValidator.validateTypedInput($0) } }
+                    let context = PipelineContext(temporalConfig: self.getTemporalConfiguration())
+                    var results: [SecurityAssessment] = []
+                    results.reserveCapacity(validated.count)
+                    for request in validated {
+                        let assessment = try self.performAssessment(request: request, requestId: UUID(), start: Date(), context: context, lane: self.primaryLane)
+                        results.append(assessment)
                     }
+                    continuation.resume(returning: results)
+                } catch {
+                    HealthMonitor.shared.recordError()
+                    continuation.resume(throwing: error)
+                }
+            }
+        }
+    }
 
-                    // 5.1) Environmental mirror (optional)
-                    var mirrorSummary: String? = nil
-                    if self.reasoningConfig.enableEnvironmentalMirror {
-                        // Predicted predicates from fused evidence
-                        var predicted = self.buildPredictedPredicates(from: fused)
-                        // Observed predicates from translator
-                        let observedSet = Set(self.symbolicTranslator.translate(features: features, request: request))
-                        let diff = self.environmentalMirror.diff(predicted: predicted, observed: observedSet)
-                        let missingCount = diff.missingPredicates.count
-                        let unexpectedCount = diff.unexpectedPredicates.count
-                        var updatesCount = 0
-                        if missingCount > 0 || unexpectedCount > 0 {
-                            let updates = self.symbolicUpdater.proposeUpdates(diff: diff)
-                            updatesCount = updates.count
-                            let missing = diff.missingPredicates.map { $0.name }.joined(separator: ", ")
-                            let unexpected = diff.unexpectedPredicates.map { $0.name }.joined(separator: ", ")
-                            let updateHints = updates.map { $0.description }.joined(separator: "; ")
-                            mirrorSummary = "Mirror mismatch: missing=[\(missing)] unexpected=[\(unexpected)] | Updates: \(updateHints)"
-
-                            // Apply updates in-memory if enabled
-                            if self.applyMirrorUpdates {
-                                // Persist sets for future assessments (process lifetime only)
-                                for p in diff.missingPredicates { self.mirrorAddedPredicates.insert(p.name) }
-                                for p in diff.unexpectedPredicates { self.mirrorSuppressedPredicates.insert(p.name) }
+    /// Concurrent batch path: validate up front, group events by the lane
+    /// that owns their location, and run each group on its lane's queue.
+    /// Events for one location keep their batch order on one lane — the same
+    /// state a single `assess` for that location would touch — while
+    /// independent locations run in parallel. The queue hop and pipeline
+    /// context are paid once per lane group, and results return in input
+    /// order.
+    private func assessBatchConcurrent(_ requests: [String]) async throws -> [SecurityAssessment] {
+        let validated: [SecurityEventRequest]
+        do {
+            validated = try StageProfiler.shared.measure(.validation) { try requests.map { try InputValidator.validateTypedInput($0) } }
+        } catch {
+            HealthMonitor.shared.recordError()
+            throw error
+        }
+
+        // Group by owning lane, remembering each event's batch position
+        var groups: [ObjectIdentifier: (lane: AssessmentLane, items: [(index: Int, request: SecurityEventRequest)])] = [:]
+        for (index, request) in validated.enumerated() {
+            let lane = routingLane(for: request.location ?? "unknown")
+            groups[ObjectIdentifier(lane), default: (lane, [])].items.append((index, request))
+        }
+
+        var results = [SecurityAssessment?](repeating: nil, count: validated.count)
+        try await withThrowingTaskGroup(of: [(Int, SecurityAssessment)].self) { taskGroup in
+            for group in groups.values {
+                taskGroup.addTask {
+                    try await withCheckedThrowingContinuation { continuation in
+                        group.lane.queue.async {
+                            do {
+                                let context = PipelineContext(temporalConfig: self.getTemporalConfiguration())
+                                var out: [(Int, SecurityAssessment)] = []
+                                out.reserveCapacity(group.items.count)
+                                for (index, request) in group.items {
+                                    out.append((index, try self.performAssessment(request: request, requestId: UUID(), start: Date(), context: context, lane: group.lane)))
+                                }
+                                continuation.resume(returning: out)
+                            } catch {
+                                HealthMonitor.shared.recordError()
+                                continuation.resume(throwing: error)
                             }
-                        } else {
-                            mirrorSummary = "Mirror: predicted matches observed"
                         }
-
-                        // Telemetry
-                        MirrorTelemetry.shared.record(missing: missingCount, unexpected: unexpectedCount, updates: updatesCount, durationMs: 0)
                     }
+                }
+            }
+            for try await laneResults in taskGroup {
+                for (index, assessment) in laneResults {
+                    results[index] = assessment
+                }
+            }
+        }
+        return results.compactMap { $0 }
+    }
 
-                    // 6) Map and build assessment
-                    let level = self.mapScoreToThreatLevel(finalScore)
-                    var reasoning = self.buildExplanation(
-                        fused: fused,
-                        rules: ruleResult,
-                        chainPattern: chainPattern,
-                        motionAnalysis: motionAnalysis,
-                        zoneRiskScore: zoneRiskScore,
-                        plan: combinedPlan,
-                        mirror: mirrorSummary
-                    )
-                    // Append fuzzy and belief trace for transparency (P1)
-                    var traceParts: [String] = []
-                    if fuzzyThreat >= 0 {
-                        traceParts.append("Fuzzy: intent=\(fuzzyIntent) threat=\(String(format: "%.2f", fuzzyThreat)) rules=\(fuzzyRules.prefix(2).joined(separator: ","))")
-                    }
-                    if !beliefNew.isEmpty {
-                        func pct(_ x: Double?) -> String { String(format: "%.0f%%", (x ?? 0)*100) }
-                        let deltaIntr = (beliefNew["intrusion"] ?? 0) - (beliefPrev["intrusion"] ?? 0)
-                        traceParts.append("Beliefs: deliv=\(pct(beliefNew["delivery"])) intr=\(pct(beliefNew["intrusion"])) (Δ=\(String(format: "%.0f%%", deltaIntr*100))) prowler=\(pct(beliefNew["prowler"])) pet=\(pct(beliefNew["pet"]))")
-                    }
-                    if !traceParts.isEmpty { reasoning += " | " + traceParts.joined(separator: " | ") }
-                    
-                    // 6) Generate personalized, adaptive explanation
-                    let zone = self.zoneClassifier.classifyLocation(
-                        (request["metadata"] as? [String: Any])?["location"] as? String ?? "unknown"
-                    )
-                    let config = self.getTemporalConfiguration()
-                    // P1: Time context from EVENT TIMESTAMP (not wall clock)
-                    var calendarWithTZ = Calendar(identifier: .gregorian)
-                    calendarWithTZ.timeZone = config.timezone
-                    let eventTs = (request["timestamp"] as? Double) ?? Date().timeIntervalSince1970
-                    let eventDate = Date(timeIntervalSince1970: eventTs)
-                    let currentHour = calendarWithTZ.component(.hour, from: eventDate)
-                    let isDeliveryWindow = (config.deliveryWindowStart...config.deliveryWindowEnd).contains(currentHour)
-                    let isNight = currentHour >= config.nightStart || currentHour < config.nightEnd
-                    
-                    let timeContext = ExplanationEngine.TimeContext(
-                        currentHour: currentHour,
-                        isNight: isNight,
-                        isDeliveryWindow: isDeliveryWindow,
-                        deliveryWindowStart: config.deliveryWindowStart,
-                        deliveryWindowEnd: config.deliveryWindowEnd
-                    )
-                    
-                    let explanation = ExplanationEngine.explain(
-                        threatLevel: level,
-                        chainPattern: chainPattern,
-                        motionAnalysis: motionFeatures,
-                        zone: zone,
-                        timeContext: timeContext,
-                        userPatterns: Self.sharedUserPatterns,
-                        eventType: request["type"] as? String ?? "unknown",
-                        homeMode: (request["metadata"] as? [String: Any])?["home_mode"] as? String ?? "home"
-                    )
-                    
-                    let ms = Date().timeIntervalSince(start) * 1000.0
-                    let assessment = SecurityAssessment(
-                        threatLevel: level,
-                        confidence: fused.confidence,
-                        processingTimeMs: ms,
-                        reasoning: reasoning,
-                        requestId: requestId.uuidString,
-                        timestamp: ISO8601DateFormatter().string(from: Date()),
-                        summary: explanation.summary,
-                        detailedReasoning: explanation.reasoning,
-                        context: explanation.context,
-                        recommendation: explanation.recommendation
-                    )
-                    
-                    // P0.3: Health monitoring
-                    HealthMonitor.shared.recordAssessment(processingTimeMs: ms)
-                    
-                    // P1.4: Audit trail
-                    let auditTrail = AuditTrail(
-                        requestId: requestId,
-                        timestamp: Date(),
-                        inputHash: AuditTrail.hashInput(request),
-                        configVersion: Self.sdkVersion,
-                        sdkMode: self.currentMode.rawValue,
-                        eventType: request["type"] as? String,
-                        eventLocation: (request["metadata"] as? [String: Any])?["location"] as? String,
-                        intermediateScores: [
-                            "bayesian": fused.bayesianContribution,
-                            "rules": fused.ruleContribution,
-                            "chain_adjustment": chainAdjustment,
-                            "zone_risk": zoneRiskScore,
-                            "fuzzy_threat": (fuzzyThreat >= 0 ? fuzzyThreat : 0.0),
-                            "belief_delivery": beliefNew["delivery"] ?? 0.0,
-                            "belief_intrusion": beliefNew["intrusion"] ?? 0.0,
-                            "belief_prowler": beliefNew["prowler"] ?? 0.0,
-                            "belief_pet": beliefNew["pet"] ?? 0.0,
-                            "fear": self.reasoningConfig.enableFearChain ? fearScore : 0.0,
-                            "normality": self.reasoningConfig.enableFearChain ? normality : 0.0,
-                            "safety_adjustment": self.reasoningConfig.enableFearChain ? safetyAdjustmentVal : 0.0,
-                            "mirror_missing": self.reasoningConfig.enableEnvironmentalMirror ? Double(MirrorTelemetry.shared.lastMissing) : 0.0,
-                            "mirror_unexpected": self.reasoningConfig.enableEnvironmentalMirror ? Double(MirrorTelemetry.shared.lastUnexpected) : 0.0,
-                            "mirror_updates": self.reasoningConfig.enableEnvironmentalMirror ? Double(MirrorTelemetry.shared.lastUpdates) : 0.0
-                        ],
-                        rulesTriggered: ruleResult.factors,
-                        chainPattern: chainPattern?.name,
-                        motionAnalysis: motionAnalysis,
-                        zoneRiskScore: zoneRiskScore,
-                        finalThreatLevel: level.rawValue,
-                        finalScore: finalScore,
-                        confidence: fused.confidence,
-                        processingTimeMs: ms,
-                        fusionBreakdown: AuditTrail.FusionBreakdown(
-                            bayesianScore: fused.bayesianContribution,
-                            ruleBasedScore: fused.ruleContribution,
-                            mentalModelAdjustment: 0.0,
-                            temporalDampening: 0.0,
-                            chainPatternAdjustment: chainAdjustment,
-                            finalScore: finalScore
-                        ),
-                        temporalFactors: [:]
-                    )
-                    AuditTrailManager.shared.record(auditTrail)
-                    
+    /// Shared post-validation entry: route an already-validated request to
+    /// the lane that owns its location and run the pipeline. Typed ingestion
+    /// paths (dictionary feeds, event streams) land here without any JSON
+    /// round-trip. Streams pass `rateLimited: false` — their bounded buffer
+    /// is the admission control, so storms queue instead of throwing.
+    internal func assessValidated(_ request: SecurityEventRequest, rateLimited: Bool = true, chainAlreadyBuffered: Bool = false) async throws -> SecurityAssessment {
+        guard isInitialized else { throw NovinIntelligenceError.notInitialized }
+
+        if rateLimited {
+            guard rateLimiter.allow() else {
+                HealthMonitor.shared.recordError()
+                throw InputValidator.ValidationError.rateLimitExceeded
+            }
+        }
+
+        let lane = routingLane(for: request.location ?? "unknown")
+        return try await withCheckedThrowingContinuation { continuation in
+            lane.queue.async {
+                do {
+                    let context = PipelineContext(temporalConfig: self.getTemporalConfiguration())
+                    let assessment = try self.performAssessment(request: request, requestId: UUID(), start: Date(), context: context, lane: lane, chainAlreadyBuffered: chainAlreadyBuffered)
                     continuation.resume(returning: assessment)
                 } catch {
-                    // P0.3: Record error in health monitor
                     HealthMonitor.shared.recordError()
                     continuation.resume(throwing: error)
                 }
@@ -583,41 +598,513 @@ public final class NovinIntelligence: @unchecked Sendable {
         }
     }
 
+    /// Admission control for scheduler priority events: consumes one
+    /// rate-limit token, mirroring `assess`'s DoS protection. The scheduler's
+    /// priority lane has no backpressure of its own, so unlike the bounded
+    /// event stream it must not bypass the token bucket.
+    internal func admitPriorityEvent() throws {
+        guard rateLimiter.allow() else {
+            HealthMonitor.shared.recordError()
+            throw InputValidator.ValidationError.rateLimitExceeded
+        }
+    }
+
+    /// Park a low-signal event in its lane's chain buffer without running the
+    /// pipeline. Returns a pattern if the event completes or extends a chain —
+    /// the scheduler's cue to promote the event to an immediate assessment.
+    internal func bufferDeferredEvent(_ request: SecurityEventRequest) -> EventChainAnalyzer.ChainPattern? {
+        guard isInitialized,
+              let eventType = request.type,
+              let timestamp = request.timestamp,
+              let locationStr = request.location else { return nil }
+
+        let lane = routingLane(for: locationStr)
+        let event = EventChainAnalyzer.SecurityEvent(
+            type: eventType,
+            timestamp: Date(timeIntervalSince1970: timestamp),
+            location: locationStr,
+            confidence: request.confidence ?? 0.5,
+            metadata: request.raw
+        )
+        return lane.queue.sync { lane.eventChainAnalyzer.analyzeChain(event) }
+    }
+
+    /// Open a two-lane scheduler in front of the pipeline: high-signal events
+    /// assess immediately, low-signal chatter parks in the chain buffer and
+    /// coalesces into one assessment per location per interval, promoted the
+    /// moment a chain pattern starts forming. See `EventScheduler`.
+    public func openEventScheduler(coalesceInterval: TimeInterval = 3.0, lowSignalTypes: Set<String> = EventScheduler.defaultLowSignalTypes) -> EventScheduler {
+        return EventScheduler(sdk: self, coalesceInterval: coalesceInterval, lowSignalTypes: lowSignalTypes)
+    }
+
     /// Assess and return PI-format JSON string for partner ingestion
     public func assessPI(requestJson: String) async throws -> String {
         let result = try await assess(requestJson: requestJson)
         return try result.toPI()
     }
-    
-    /// Feed any security event to the AI engine
+
+    /// Feed any security event to the AI engine. Dictionaries and raw JSON
+    /// bytes are validated in place — no serialize/reparse round-trip.
     public func feedSecurityEvent(_ event: Any) async {
         guard isInitialized else {
             print("⚠️ NovinIntelligence not initialized")
             return
         }
-        
+
         if let jsonString = event as? String {
             _ = try? await assess(requestJson: jsonString)
         } else if let dictionary = event as? [String: Any],
-                  let jsonData = try? JSONSerialization.data(withJSONObject: dictionary),
-                  let jsonString = String(data: jsonData, encoding: .utf8) {
-            _ = try? await assess(requestJson: jsonString)
+                  let request = try? InputValidator.validateTypedInput(dictionary) {
+            _ = try? await assessValidated(request)
+        } else if let data = event as? Data,
+                  let request = try? InputValidator.validateTypedInput(data: data) {
+            _ = try? await assessValidated(request)
         }
     }
-    
+
+    /// Open a streaming ingestion channel with bounded buffering.
+    /// See `SecurityEventStream` for the backpressure contract.
+    public func openEventStream(bufferingUpTo capacity: Int = 256) -> SecurityEventStream {
+        return SecurityEventStream(sdk: self, capacity: capacity)
+    }
+
     /// Set system mode for threat assessment context
     public func setSystemMode(_ mode: String) {
         print("🏠 System mode set to: \(mode)")
     }
-    
+
+    // MARK: - Assessment Pipeline
+
+    /// Per-call pipeline state that is identical for every event in a batch.
+    /// Formatter and calendar construction are expensive enough to matter during
+    /// bursts, so they are allocated once per pipeline entry and shared.
+    private struct PipelineContext {
+        let temporalConfig: TemporalConfiguration
+        let timestampFormatter: ISO8601DateFormatter
+        let calendar: Calendar
+
+        init(temporalConfig: TemporalConfiguration) {
+            self.temporalConfig = temporalConfig
+            self.timestampFormatter = ISO8601DateFormatter()
+            var cal = Calendar(identifier: .gregorian)
+            cal.timeZone = temporalConfig.timezone
+            self.calendar = cal
+        }
+    }
+
+    /// Run the full assessment pipeline for one validated request.
+    /// Must be called on the queue of the lane that owns this event's location.
+    private func performAssessment(request: SecurityEventRequest, requestId: UUID, start: Date, context: PipelineContext, lane: AssessmentLane, chainAlreadyBuffered: Bool = false) throws -> SecurityAssessment {
+        // Emergency mode: Return safe default
+        if self.currentMode == .emergency {
+            return SecurityAssessment(
+                threatLevel: .standard,
+                confidence: 0.5,
+                processingTimeMs: Date().timeIntervalSince(start) * 1000.0,
+                reasoning: "Emergency mode: Safe fallback response",
+                requestId: requestId.uuidString,
+                timestamp: context.timestampFormatter.string(from: Date())
+            )
+        }
+
+        // Duplicate suppression: consult the memo cache before any stateful
+        // component sees the event, so chain buffers, beliefs, and normality
+        // statistics never double-update on a redelivery
+        var memoKey: String? = nil
+        if let cache = self.memoCache {
+            let key = AuditTrail.hashInput(request.raw)
+            memoKey = key
+            if let cached = cache.lookup(key) {
+                let ms = Date().timeIntervalSince(start) * 1000.0
+                var duplicate = SecurityAssessment(
+                    threatLevel: cached.threatLevel,
+                    confidence: cached.confidence,
+                    processingTimeMs: ms,
+                    reasoning: cached.reasoning,
+                    requestId: requestId.uuidString,
+                    timestamp: context.timestampFormatter.string(from: Date()),
+                    summary: cached.summary,
+                    detailedReasoning: cached.detailedReasoning,
+                    context: cached.context,
+                    recommendation: cached.recommendation
+                )
+                duplicate.explanationToken = cached.explanationToken
+                // Duplicates still count toward health throughput
+                HealthMonitor.shared.recordAssessment(processingTimeMs: ms)
+                return duplicate
+            }
+        }
+
+        // P1.1: Event chain analysis. Scheduler-deferred events are already
+        // in the buffer, so their coalesced assessment only reads the current
+        // pattern instead of inserting twice.
+        var chainPattern: EventChainAnalyzer.ChainPattern?
+        var chainAdjustment: Double = 0.0
+        if chainAlreadyBuffered {
+            chainPattern = StageProfiler.shared.measure(.chainAnalysis) { lane.eventChainAnalyzer.currentPattern() }
+            chainAdjustment = chainPattern?.threatDelta ?? 0.0
+        } else if let eventType = request.type,
+           let timestamp = request.timestamp,
+           let locationStr = request.location {
+            let event = EventChainAnalyzer.SecurityEvent(
+                type: eventType,
+                timestamp: Date(timeIntervalSince1970: timestamp),
+                location: locationStr,
+                confidence: request.confidence ?? 0.5,
+                metadata: request.raw
+            )
+            chainPattern = StageProfiler.shared.measure(.chainAnalysis) { lane.eventChainAnalyzer.analyzeChain(event) }
+            chainAdjustment = chainPattern?.threatDelta ?? 0.0
+        }
+
+        // P1.3: Zone classification (resolved once per request; the risk
+        // score here and the explanation zone below share this handle)
+        let resolvedZone = self.zoneClassifier.classifyLocation(request.location ?? "unknown")
+        let zoneRiskScore: Double = request.location != nil ? resolvedZone.riskScore : 0.5
+
+        // 1) Extract named features
+        var features = StageProfiler.shared.measure(.featureExtraction) { self.featureExtractor.extractNamedFeatures(from: request.raw) }
+
+        // P1.2: Motion analysis (if motion event)
+        var motionAnalysis: String?
+        var motionFeatures: MotionAnalyzer.MotionFeatures?
+        // Fuzzy + beliefs (P1)
+        var fuzzyThreat: Double = -1
+        var fuzzyIntent: String = ""
+        var fuzzyIntentScores: [String: Double] = [:]
+        var fuzzyRules: [String] = []
+        var beliefPrev: [String: Double] = [:]
+        var beliefNew: [String: Double] = [:]
+        if let metadata = request.metadata, request.isMotionEvent {
+            let analyzed = MotionAnalyzer.analyzeFromMetadata(metadata)
+            motionFeatures = analyzed
+            motionAnalysis = "\(analyzed.activityType.rawValue) (\(String(format: "%.0f", analyzed.confidence * 100))%)"
+
+            // Adjust features based on motion analysis
+            if analyzed.activityType == .package_drop {
+                features["event_motion"] = (features["event_motion"] ?? 1.0) * 0.6
+            } else if analyzed.activityType == .loitering {
+                features["event_motion"] = (features["event_motion"] ?? 1.0) * 1.3
+            }
+
+            // Fuzzy micro-kernel (duration/energy from metadata if present)
+            let duration = analyzed.duration
+            let energy = analyzed.energy
+            // Home mode + activity hint
+            let homeMode = request.metadataHomeMode ?? "home"
+            let activityHint = request.activityHint
+            // Event hour from event timestamp (P1: use event timestamp, not wall clock)
+            let eventHour = context.calendar.component(.hour, from: Date(timeIntervalSince1970: request.eventTimestamp))
+
+            let fuzzy = MotionAnalyzer.fuzzyAssess(
+                duration: duration,
+                energy: energy,
+                zoneRisk: zoneRiskScore,
+                eventHour: eventHour,
+                homeMode: homeMode,
+                activityHint: activityHint
+            )
+            fuzzyThreat = fuzzy.threat
+            fuzzyIntent = fuzzy.intent
+            fuzzyIntentScores = fuzzy.intentScores
+            fuzzyRules = fuzzy.rules
+
+            // Minimal belief update (P1): accumulate evidence across events
+            // Map fuzzy intents to hypotheses and add chain/intrusion signal if present later
+            var evidence: [String: Double] = [:]
+            evidence["delivery"] = fuzzyIntentScores["delivery"] ?? 0.0
+            evidence["prowler"] = fuzzyIntentScores["prowler"] ?? 0.0
+            evidence["pet"] = fuzzyIntentScores["pet"] ?? 0.0
+            // intrusion evidence will be finalized after chain pattern detection below
+            // For now, seed with fraction of prowler likelihood
+            evidence["intrusion"] = max(0.0, (fuzzyIntentScores["prowler"] ?? 0.0) * 0.5)
+
+            let key = request.location ?? "unknown"
+            let update = lane.beliefStore.update(key: key, evidence: evidence)
+            beliefPrev = update.prev
+            beliefNew = update.next
+        }
+
+        // Inject zone risk into features
+        features["zone_risk"] = zoneRiskScore
+
+        // 2) Rule reasoning (skip in minimal mode)
+        var ruleResult: ReasoningSwift.Result
+        if self.currentMode == .minimal {
+            ruleResult = ReasoningSwift.Result(
+                assessment: "minimal_mode",
+                confidence: 0.5,
+                chain: [],
+                factors: [],
+                recommendations: [],
+                riskScore: 0.5
+            )
+        } else {
+            ruleResult = StageProfiler.shared.measure(.ruleReasoning) { self.reasoningEngine.reason(request: request.raw, features: features) }
+        }
+
+        // 3) Mathematical fusion (skip in minimal mode)
+        var fused: IntelligentFusion.FusionResult
+        if self.currentMode == .minimal {
+            fused = IntelligentFusion.FusionResult(
+                finalScore: ruleResult.riskScore,
+                confidence: ruleResult.confidence,
+                explanation: [],
+                bayesianContribution: 0.0,
+                ruleContribution: 1.0
+            )
+        } else {
+            fused = StageProfiler.shared.measure(.fusion) { self.fusionEngine.fuse(features: features, rules: ruleResult, request: request.raw) }
+        }
+
+        // 4) Apply chain pattern adjustment
+        var finalScore = fused.finalScore + chainAdjustment
+
+        // 4.1) FEAR-Chain safety adjustment (training-free, lightweight)
+        var fearScore: Double = 0.0
+        var normality: Double = 0.0
+        var safetyAdjustmentVal: Double = 0.0
+        if self.reasoningConfig.enableFearChain {
+            fearScore = self.fearHeuristic.score(features: features)
+            // Compute normality against running mean BEFORE update
+            normality = lane.normalityTracker.score(features: features)
+            // Update statistics for next observations (online, no training)
+            lane.normalityTracker.update(features: features)
+            // Conservative weights: amplify threat slightly, dampen by normality
+            let alpha = 0.15
+            let beta = 0.10
+            safetyAdjustmentVal = alpha * fearScore - beta * normality
+            finalScore += safetyAdjustmentVal
+        }
+
+        // Pet-in-home dampening (P1)
+        if request.metadata != nil {
+            let homeMode = request.metadataHomeMode ?? "home"
+            if homeMode == "home" {
+                // If fuzzy intent is pet with meaningful weight, dampen
+                let petWeight = fuzzyIntentScores["pet"] ?? 0.0
+                if petWeight > 0.4 {
+                    finalScore = finalScore * (1.0 - min(1.0, max(0.0, context.temporalConfig.petDampeningFactor)))
+                }
+            }
+        }
+
+        finalScore = max(0.0, min(1.0, finalScore))
+
+        // 5) Optional symbolic planning (training-free, behind flags)
+        var combinedPlan: Plan? = nil
+        if self.reasoningConfig.enableSymbolicPlanner || self.reasoningConfig.enableAffordancePlanner {
+            // Build initial world from features via translator
+            let preds = self.symbolicTranslator.translate(features: features, request: request.raw)
+            let world = WorldStateGraph()
+            for p in preds { world.addPredicate(p) }
+
+            var steps: [Action] = []
+            if self.reasoningConfig.enableAffordancePlanner {
+                let ap = self.affordancePlanner.suggest(features: features, metadata: request.metadata)
+                steps.append(contentsOf: ap.steps)
+            }
+            if self.reasoningConfig.enableSymbolicPlanner {
+                let sp = self.symbolicPlanner.plan(initial: world, goalDescription: [Predicate("stage_act")], maxNodes: 128)
+                steps.append(contentsOf: sp.steps)
+            }
+            combinedPlan = Plan(steps: steps, estimatedCost: Double(steps.count))
+        }
+
+        // 5.1) Environmental mirror (optional)
+        var mirrorSummary: String? = nil
+        if self.reasoningConfig.enableEnvironmentalMirror {
+            // Predicted predicates from fused evidence
+            let predicted = self.buildPredictedPredicates(from: fused)
+            // Observed predicates from translator
+            let observedSet = Set(self.symbolicTranslator.translate(features: features, request: request.raw))
+            let diff = self.environmentalMirror.diff(predicted: predicted, observed: observedSet)
+            let missingCount = diff.missingPredicates.count
+            let unexpectedCount = diff.unexpectedPredicates.count
+            var updatesCount = 0
+            if missingCount > 0 || unexpectedCount > 0 {
+                let updates = self.symbolicUpdater.proposeUpdates(diff: diff)
+                updatesCount = updates.count
+                let missing = diff.missingPredicates.map { $0.name }.joined(separator: ", ")
+                let unexpected = diff.unexpectedPredicates.map { $0.name }.joined(separator: ", ")
+                let updateHints = updates.map { $0.description }.joined(separator: "; ")
+                mirrorSummary = "Mirror mismatch: missing=[\(missing)] unexpected=[\(unexpected)] | Updates: \(updateHints)"
+
+                // Apply updates to the knowledge base if enabled (persisted
+                // across restarts on the main engine)
+                if self.applyMirrorUpdates {
+                    self.mirrorKnowledge.learn(
+                        added: diff.missingPredicates.map { $0.name },
+                        suppressed: diff.unexpectedPredicates.map { $0.name }
+                    )
+                }
+            } else {
+                mirrorSummary = "Mirror: predicted matches observed"
+            }
+
+            // Telemetry
+            MirrorTelemetry.shared.record(missing: missingCount, unexpected: unexpectedCount, updates: updatesCount, durationMs: 0)
+        }
+
+        // 6) Map and build assessment
+        let level = Self.mapScoreToThreatLevel(finalScore)
+
+        // P1: Time context from EVENT TIMESTAMP (not wall clock)
+        let eventDate = Date(timeIntervalSince1970: request.eventTimestamp)
+        let currentHour = context.calendar.component(.hour, from: eventDate)
+        let config = context.temporalConfig
+        let isDeliveryWindow = (config.deliveryWindowStart...config.deliveryWindowEnd).contains(currentHour)
+        let isNight = currentHour >= config.nightStart || currentHour < config.nightEnd
+
+        let timeContext = ExplanationEngine.TimeContext(
+            currentHour: currentHour,
+            isNight: isNight,
+            isDeliveryWindow: isDeliveryWindow,
+            deliveryWindowStart: config.deliveryWindowStart,
+            deliveryWindowEnd: config.deliveryWindowEnd
+        )
+
+        // Capture the explanation inputs as plain values. In lazy mode this
+        // token is the whole explanation cost on the hot path; automation
+        // consumers that only read threatLevel/confidence never pay for text.
+        let explanationToken = ExplanationToken(
+            threatLevel: level,
+            fused: fused,
+            rules: ruleResult,
+            chainPattern: chainPattern,
+            motionAnalysis: motionAnalysis,
+            motionFeatures: motionFeatures,
+            zone: resolvedZone,
+            zoneRiskScore: zoneRiskScore,
+            timeContext: timeContext,
+            eventType: request.type ?? "unknown",
+            homeMode: request.metadataHomeMode ?? "home",
+            plan: combinedPlan,
+            mirror: mirrorSummary,
+            fuzzyThreat: fuzzyThreat,
+            fuzzyIntent: fuzzyIntent,
+            fuzzyRules: fuzzyRules,
+            beliefPrev: beliefPrev,
+            beliefNew: beliefNew,
+            userPatterns: self.userPatterns
+        )
+
+        // 6.1) Generate explanations eagerly unless deferred
+        let rendered: ExplanationToken.Rendered?
+        if self.lazyExplanationsEnabled {
+            rendered = nil
+        } else {
+            rendered = StageProfiler.shared.measure(.explanation) { explanationToken.render() }
+        }
+
+        let ms = Date().timeIntervalSince(start) * 1000.0
+        var assessment = SecurityAssessment(
+            threatLevel: level,
+            confidence: fused.confidence,
+            processingTimeMs: ms,
+            reasoning: rendered?.reasoning ?? "deferred — call renderExplanation()",
+            requestId: requestId.uuidString,
+            timestamp: context.timestampFormatter.string(from: Date()),
+            summary: rendered?.summary,
+            detailedReasoning: rendered?.detailedReasoning,
+            context: rendered?.context,
+            recommendation: rendered?.recommendation
+        )
+        assessment.explanationToken = explanationToken
+
+        // Remember the decision for short-window duplicates
+        if let memoKey = memoKey {
+            self.memoCache?.store(memoKey, assessment)
+        }
+
+        // P0.3: Health monitoring
+        HealthMonitor.shared.recordAssessment(processingTimeMs: ms)
+
+        // P1.4: Audit trail (tiered: benign traffic can record a minimal
+        // trail, keeping the audit path near-free on the hot path)
+        let wantsFullTrail: Bool
+        switch self.auditDetailPolicy {
+        case .full:
+            wantsFullTrail = true
+        case .tiered(let sampleRate):
+            if level == .low {
+                wantsFullTrail = sampleRate > 0 && Double.random(in: 0..<1) < sampleRate
+            } else {
+                wantsFullTrail = true
+            }
+        }
+
+        if !wantsFullTrail {
+            auditTrails.record(AuditTrail.minimal(
+                requestId: requestId,
+                timestamp: Date(),
+                inputHash: AuditTrail.hashInput(request.raw),
+                configVersion: Self.sdkVersion,
+                sdkMode: self.currentMode.rawValue,
+                finalThreatLevel: level.rawValue,
+                finalScore: finalScore,
+                confidence: fused.confidence,
+                processingTimeMs: ms
+            ))
+            return assessment
+        }
+
+        let auditTrail = AuditTrail(
+            requestId: requestId,
+            timestamp: Date(),
+            inputHash: AuditTrail.hashInput(request.raw),
+            configVersion: Self.sdkVersion,
+            sdkMode: self.currentMode.rawValue,
+            eventType: request.type,
+            eventLocation: request.location,
+            intermediateScores: [
+                "bayesian": fused.bayesianContribution,
+                "rules": fused.ruleContribution,
+                "chain_adjustment": chainAdjustment,
+                "zone_risk": zoneRiskScore,
+                "fuzzy_threat": (fuzzyThreat >= 0 ? fuzzyThreat : 0.0),
+                "belief_delivery": beliefNew["delivery"] ?? 0.0,
+                "belief_intrusion": beliefNew["intrusion"] ?? 0.0,
+                "belief_prowler": beliefNew["prowler"] ?? 0.0,
+                "belief_pet": beliefNew["pet"] ?? 0.0,
+                "fear": self.reasoningConfig.enableFearChain ? fearScore : 0.0,
+                "normality": self.reasoningConfig.enableFearChain ? normality : 0.0,
+                "safety_adjustment": self.reasoningConfig.enableFearChain ? safetyAdjustmentVal : 0.0,
+                "mirror_missing": self.reasoningConfig.enableEnvironmentalMirror ? Double(MirrorTelemetry.shared.lastMissing) : 0.0,
+                "mirror_unexpected": self.reasoningConfig.enableEnvironmentalMirror ? Double(MirrorTelemetry.shared.lastUnexpected) : 0.0,
+                "mirror_updates": self.reasoningConfig.enableEnvironmentalMirror ? Double(MirrorTelemetry.shared.lastUpdates) : 0.0
+            ],
+            rulesTriggered: ruleResult.factors,
+            chainPattern: chainPattern?.name,
+            motionAnalysis: motionAnalysis,
+            zoneRiskScore: zoneRiskScore,
+            finalThreatLevel: level.rawValue,
+            finalScore: finalScore,
+            confidence: fused.confidence,
+            processingTimeMs: ms,
+            fusionBreakdown: AuditTrail.FusionBreakdown(
+                bayesianScore: fused.bayesianContribution,
+                ruleBasedScore: fused.ruleContribution,
+                mentalModelAdjustment: 0.0,
+                temporalDampening: 0.0,
+                chainPatternAdjustment: chainAdjustment,
+                finalScore: finalScore
+            ),
+            temporalFactors: [:]
+        )
+        auditTrails.record(auditTrail)
+
+        return assessment
+    }
+
     // MARK: - Private Helpers
-    
+
     private func parseAssessment(from jsonString: String) throws -> SecurityAssessment {
         guard let data = jsonString.data(using: .utf8),
               let json = try JSONSerialization.jsonObject(with: data) as? [String: Any] else {
             throw NovinIntelligenceError.processingFailed("Invalid JSON response")
         }
-        
+
         // Extract fields from response
         guard let threatLevelString = json["threatLevel"] as? String,
               let threatLevel = ThreatLevel(rawValue: threatLevelString),
@@ -626,10 +1113,10 @@ public final class NovinIntelligence: @unchecked Sendable {
               let reasoning = json["reasoning"] as? String else {
             throw NovinIntelligenceError.processingFailed("Missing required fields in response")
         }
-        
+
         let requestId = json["requestId"] as? String
         let timestamp = json["timestamp"].flatMap { "\($0)" }
-        
+
         return SecurityAssessment(
             threatLevel: threatLevel,
             confidence: confidence,
@@ -639,7 +1126,7 @@ public final class NovinIntelligence: @unchecked Sendable {
             timestamp: timestamp
         )
     }
-    
+
     /// Assess a motion event
     public func assessMotion(confidence: Double, location: String = "unknown") async throws -> SecurityAssessment {
         let motionJson = """
@@ -654,7 +1141,7 @@ public final class NovinIntelligence: @unchecked Sendable {
             }
         }
         """
-        
+
         return try await assess(requestJson: motionJson)
     }
 
@@ -663,7 +1150,7 @@ public final class NovinIntelligence: @unchecked Sendable {
         let result = try await assessMotion(confidence: confidence, location: location)
         return try result.toPI()
     }
-    
+
     /// Assess a door event
     public func assessDoorEvent(isOpening: Bool, location: String = "frontDoor") async throws -> SecurityAssessment {
         let doorJson = """
@@ -679,7 +1166,7 @@ public final class NovinIntelligence: @unchecked Sendable {
             }
         }
         """
-        
+
         return try await assess(requestJson: doorJson)
     }
 
@@ -690,7 +1177,7 @@ public final class NovinIntelligence: @unchecked Sendable {
     }
 
     // MARK: - Math + Rules helpers
-    private func mapScoreToThreatLevel(_ score: Double) -> ThreatLevel {
+    internal static func mapScoreToThreatLevel(_ score: Double) -> ThreatLevel {
         switch score {
         case 0.9...1.0: return .critical
         case 0.7..<0.9: return .elevated
@@ -699,68 +1186,17 @@ public final class NovinIntelligence: @unchecked Sendable {
         }
     }
 
-    private func buildExplanation(
-        fused: IntelligentFusion.FusionResult,
-        rules: ReasoningSwift.Result,
-        chainPattern: EventChainAnalyzer.ChainPattern?,
-        motionAnalysis: String?,
-        zoneRiskScore: Double,
-        plan: Plan?,
-        mirror: String?
-    ) -> String {
-        var parts: [String] = []
-        parts.append("Assessment: \(mapScoreToThreatLevel(fused.finalScore).rawValue.uppercased())")
-        
-        // Chain pattern
-        if let chain = chainPattern {
-            parts.append("Chain: \(chain.name) (\(chain.reasoning))")
-        }
-        
-        // Motion analysis
-        if let motion = motionAnalysis {
-            parts.append("Motion: \(motion)")
-        }
-        
-        // Zone risk
-        parts.append("Zone Risk: \(String(format: "%.0f", zoneRiskScore * 100))%")
-
-        // Optional plan steps
-        if let plan = plan, !plan.steps.isEmpty {
-            let stepNames = plan.steps.map { $0.name }.joined(separator: " → ")
-            parts.append("Plan: \(stepNames)")
-        }
-        // Optional mirror summary
-        if let mirror = mirror { parts.append(mirror) }
-        
-        // Top math evidence by weight
-        let top = fused.explanation.sorted { $0.weight > $1.weight }.prefix(3)
-        if !top.isEmpty {
-            let desc = top.map { "\($0.name): \($0.present > 0.5 ? "STRONG" : "WEAK")" }.joined(separator: ", ")
-            parts.append("Math: \(desc)")
-        }
-        if !rules.factors.isEmpty {
-            let names = rules.factors.prefix(3)
-            parts.append("Rules: \(names.joined(separator: ", "))")
-        }
-        parts.append("Bayes: \(String(format: "%.0f", fused.bayesianContribution*100))% | Rules: \(String(format: "%.0f", fused.ruleContribution*100))%")
-        parts.append("Confidence: \(String(format: "%.0f", fused.confidence*100))%")
-        parts.append("Final: \(String(format: "%.1f", fused.finalScore*100))% threat probability")
-        return parts.joined(separator: " | ")
-    }
-
     // MARK: - Phase 4 helpers
     private func buildPredictedPredicates(from fused: IntelligentFusion.FusionResult) -> Set<Predicate> {
-        var set: Set<Predicate> = []
-        // Include starting planner stage to align with translator's observed seeds
-        set.insert(Predicate("stage_observe"))
+        // Starting planner stage aligns with translator's observed seeds;
+        // evidence factor names map to canonical predicate names
+        var base: [String] = ["stage_observe"]
+        base.reserveCapacity(1 + fused.explanation.count)
         for e in fused.explanation where e.present > 0.5 {
-            // Map evidence factor names to canonical predicate names
-            let name = e.name
-            set.insert(Predicate(name))
-        }
-        // Apply in-memory mirror adjustments if any
-        for a in mirrorAddedPredicates { set.insert(Predicate(a)) }
-        for s in mirrorSuppressedPredicates { set.remove(Predicate(s)) }
-        return set
+            base.append(e.name)
+        }
+        // Learned additions/suppressions apply as bitset operations over
+        // interned IDs inside the knowledge base
+        return mirrorKnowledge.predicted(from: base)
     }
 }
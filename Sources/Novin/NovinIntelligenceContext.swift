@@ -0,0 +1,117 @@
+import Foundation
+import os.log
+
+/// Per-site engine for server-side multi-tenant deployments.
+///
+/// `NovinIntelligence.shared` is the right entry point for a single home on
+/// device, but a server process assessing events for thousands of homes needs
+/// isolated state per tenant: one site's event chains, beliefs, normality
+/// statistics, learned patterns, temporal config, and rate budget must never
+/// bleed into another's. Each context owns a full engine with its own copies
+/// of that mutable state while sharing the process-wide immutable machinery
+/// (compiled rules via copy-on-write, fusion likelihood tables, feature slot
+/// layouts), so holding thousands of contexts in memory is cheap.
+///
+/// Context engines never touch disk: user patterns start from defaults and
+/// learn in memory only, and audit trails stay in a per-engine in-memory
+/// manager rather than the process-wide persistent log — persistence is the
+/// host application's concern in a multi-tenant deployment. Construction is
+/// synchronous; no `initialize()` call is needed.
+///
+///     let site = NovinIntelligenceContext(siteId: "home-8841")
+///     let assessment = try await site.assess(requestJson: eventJson)
+@available(iOS 15.0, macOS 12.0, *)
+public final class NovinIntelligenceContext: @unchecked Sendable {
+    /// Stable identifier for the tenant/site this context serves
+    public let siteId: String
+
+    private let engine: NovinIntelligence
+
+    /// Create a ready-to-use engine for one site.
+    /// - Parameter siteId: Tenant identifier (used for logging only; events
+    ///   are still routed by their own location keys within the context)
+    public init(siteId: String) {
+        self.siteId = siteId
+        self.engine = NovinIntelligence(persistsUserPatterns: false)
+        engine.bootstrapContextEngine()
+        Logger(subsystem: "com.novinintelligence", category: "context").debug("Context created for site: \(siteId, privacy: .public)")
+    }
+
+    // MARK: - Assessment
+
+    /// Process a security event for this site
+    public func assess(requestJson: String) async throws -> SecurityAssessment {
+        return try await engine.assess(requestJson: requestJson)
+    }
+
+    /// Process a burst of correlated events for this site in one pipeline entry
+    public func assessBatch(_ requests: [String]) async throws -> [SecurityAssessment] {
+        return try await engine.assessBatch(requests)
+    }
+
+    /// Open a streaming ingestion channel for this site
+    public func openEventStream(bufferingUpTo capacity: Int = 256) -> SecurityEventStream {
+        return engine.openEventStream(bufferingUpTo: capacity)
+    }
+
+    // MARK: - Per-Site Audit
+
+    /// Get one of this site's audit trails by request ID
+    public func getAuditTrail(requestId: UUID) -> AuditTrail? {
+        return engine.getAuditTrail(requestId: requestId)
+    }
+
+    /// Get this site's recent audit trails (in-memory, bounded)
+    public func getRecentAuditTrails(limit: Int = 100) -> [AuditTrail] {
+        return engine.getRecentAuditTrails(limit: limit)
+    }
+
+    /// Export this site's retained audit trails as JSON; long-term retention
+    /// is the host application's responsibility
+    public func exportAuditTrails() -> String? {
+        return engine.exportAuditTrails()
+    }
+
+    // MARK: - Per-Site Configuration
+
+    /// Configure this site's temporal intelligence settings
+    public func configure(temporal config: TemporalConfiguration) throws {
+        try engine.configure(temporal: config)
+    }
+
+    /// Get this site's temporal configuration
+    public func getTemporalConfiguration() -> TemporalConfiguration {
+        return engine.getTemporalConfiguration()
+    }
+
+    /// Record user feedback against this site's patterns (in-memory only)
+    public func provideFeedback(eventType: String, wasFalsePositive: Bool) {
+        engine.provideFeedback(eventType: eventType, wasFalsePositive: wasFalsePositive)
+    }
+
+    /// Get this site's delivery pattern insights
+    public func getUserPatternInsights() -> DeliveryPatternInsights {
+        return engine.getUserPatternInsights()
+    }
+
+    /// Set training-free reasoning feature flags for this site
+    public func setReasoningConfig(_ config: ReasoningConfig) {
+        engine.setReasoningConfig(config)
+    }
+
+    /// Enable concurrent lane execution within this site (useful for sites
+    /// with many independent locations; most tenants can stay serial)
+    public func setConcurrentExecution(enabled: Bool, parallelism: Int = ProcessInfo.processInfo.activeProcessorCount) {
+        engine.setConcurrentExecution(enabled: enabled, parallelism: parallelism)
+    }
+
+    /// Defer explanation string building for this site's assessments
+    public func setLazyExplanations(enabled: Bool) {
+        engine.setLazyExplanations(enabled: enabled)
+    }
+
+    /// Reset this site's rate limiter (for testing)
+    public func resetRateLimiter() {
+        engine.resetRateLimiter()
+    }
+}
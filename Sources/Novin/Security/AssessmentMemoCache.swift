@@ -0,0 +1,70 @@
+import Foundation
+import os
+
+/// Short-TTL memo cache for byte-identical duplicate events.
+///
+/// Ingestion retries and double-delivering sensor hubs produce exact
+/// duplicates within seconds of the original; re-running the full pipeline
+/// for them wastes work and double-counts nothing useful. Entries key on the
+/// privacy-safe input digest (`AuditTrail.hashInput`) and expire after a few
+/// seconds, so only genuine redeliveries hit — a sensor legitimately firing
+/// twice carries a different timestamp and hashes differently.
+///
+/// Guarded by an `os_unfair_lock`: lookups and stores are a hash probe under
+/// an uncontended lock, and the table is bounded so eviction stays trivial.
+final class AssessmentMemoCache: @unchecked Sendable {
+
+    private struct Entry {
+        let assessment: SecurityAssessment
+        let expiresAt: UInt64
+    }
+
+    private let lock: UnsafeMutablePointer<os_unfair_lock_s>
+    private var entries: [String: Entry] = [:]
+    private let ttlNs: UInt64
+    private let capacity: Int
+
+    init(ttl: TimeInterval, capacity: Int = 128) {
+        self.ttlNs = UInt64(max(0.1, ttl) * 1_000_000_000)
+        self.capacity = max(8, capacity)
+        lock = UnsafeMutablePointer<os_unfair_lock_s>.allocate(capacity: 1)
+        lock.initialize(to: os_unfair_lock_s())
+    }
+
+    /// Cached assessment for this digest, if still fresh
+    func lookup(_ key: String) -> SecurityAssessment? {
+        let now = DispatchTime.now().uptimeNanoseconds
+        os_unfair_lock_lock(lock)
+        defer { os_unfair_lock_unlock(lock) }
+        guard let entry = entries[key] else { return nil }
+        if now >= entry.expiresAt {
+            entries[key] = nil
+            return nil
+        }
+        return entry.assessment
+    }
+
+    /// Remember an assessment for its digest
+    func store(_ key: String, _ assessment: SecurityAssessment) {
+        let now = DispatchTime.now().uptimeNanoseconds
+        os_unfair_lock_lock(lock)
+        if entries.count >= capacity {
+            // Drop expired entries first; if still full, drop the soonest to
+            // expire — with a few-second TTL this is effectively FIFO
+            entries = entries.filter { $0.value.expiresAt > now }
+            if entries.count >= capacity,
+               let oldest = entries.min(by: { $0.value.expiresAt < $1.value.expiresAt }) {
+                entries[oldest.key] = nil
+            }
+        }
+        entries[key] = Entry(assessment: assessment, expiresAt: now &+ ttlNs)
+        os_unfair_lock_unlock(lock)
+    }
+
+    /// Clear all entries (for testing)
+    func reset() {
+        os_unfair_lock_lock(lock)
+        entries.removeAll()
+        os_unfair_lock_unlock(lock)
+    }
+}
@@ -58,12 +58,39 @@ public struct InputValidator {
         
         // 3. Basic structure validation
         try validateStructure(request)
-        
+
         // 4. Security checks
         try performSecurityChecks(request)
-        
+
         return request
     }
+
+    /// Validate input and decode the hot-path fields into a typed request.
+    /// Parsing and field extraction happen once here; downstream stages read
+    /// stored properties instead of repeatedly probing `[String: Any]`.
+    public static func validateTypedInput(_ requestJson: String) throws -> SecurityEventRequest {
+        return SecurityEventRequest(raw: try validateInput(requestJson))
+    }
+
+    /// Validate an already-parsed request dictionary. Typed ingestion paths
+    /// (streams, dictionary feeds) land here directly, skipping the
+    /// serialize-to-JSON/reparse round-trip of the string API.
+    public static func validateTypedInput(_ request: [String: Any]) throws -> SecurityEventRequest {
+        try validateStructure(request)
+        try performSecurityChecks(request)
+        return SecurityEventRequest(raw: request)
+    }
+
+    /// Validate raw JSON bytes (single parse, no String conversion)
+    public static func validateTypedInput(data: Data) throws -> SecurityEventRequest {
+        guard data.count <= maxJsonSize else {
+            throw ValidationError.inputTooLarge(data.count)
+        }
+        guard let request = try? JSONSerialization.jsonObject(with: data) as? [String: Any] else {
+            throw ValidationError.invalidJsonStructure
+        }
+        return try validateTypedInput(request)
+    }
     
     /// Validate request structure
     private static func validateStructure(_ request: [String: Any]) throws {
@@ -1,19 +1,57 @@
 import Foundation
 
-/// Online normality tracker (training-free). Maintains running mean for numeric features.
+/// Online normality tracker (training-free). Maintains running mean and
+/// variance per feature via Welford's algorithm.
+///
+/// State lives in contiguous arrays indexed by the canonical named-feature
+/// slot layout shared with `FeatureExtractorSwift`, so the per-event
+/// score/update pair is one scatter of the incoming dictionary followed by
+/// straight-line array math over ~40 slots — tight enough for the compiler
+/// to vectorize — instead of two hashed dictionary traversals. Keys outside
+/// the canonical layout (partner extensions) keep the old dictionary path.
 public final class NormalityTracker {
+    private static let slotIds = FeatureExtractorSwift.namedFeatureSlots
+    private static let slotCount = FeatureExtractorSwift.namedFeatureNames.count
+
     private var count: Int = 0
-    private var means: [String: Double] = [:]
+    private var means: [Double]
+    private var m2: [Double]
+    private var everObserved: [Bool]
+    // Scratch observation buffer reused across calls (single-lane owner)
+    private var observation: [Double]
+    private var overflowMeans: [String: Double] = [:]
 
-    public init() {}
+    public init() {
+        means = [Double](repeating: 0, count: Self.slotCount)
+        m2 = [Double](repeating: 0, count: Self.slotCount)
+        everObserved = [Bool](repeating: false, count: Self.slotCount)
+        observation = [Double](repeating: 0, count: Self.slotCount)
+    }
 
     /// Update running statistics with a new observation
     public func update(features: [String: Double]) {
         count += 1
-        for (k, v) in features {
-            let old = means[k] ?? 0.0
-            let newMean = old + (v - old) / Double(count)
-            means[k] = newMean
+        let n = Double(count)
+
+        // Scatter: absent slots observe their current mean, which makes the
+        // Welford step a no-op for them — same effect as the old per-key
+        // update that skipped absent keys
+        for i in 0..<Self.slotCount { observation[i] = means[i] }
+        for (key, value) in features {
+            if let slot = Self.slotIds[key] {
+                observation[slot] = value
+                everObserved[slot] = true
+            } else {
+                let old = overflowMeans[key] ?? 0.0
+                overflowMeans[key] = old + (value - old) / n
+            }
+        }
+
+        // Welford pass over contiguous slots
+        for i in 0..<Self.slotCount {
+            let delta = observation[i] - means[i]
+            means[i] += delta / n
+            m2[i] += delta * (observation[i] - means[i])
         }
     }
 
@@ -21,11 +59,24 @@ public final class NormalityTracker {
     public func score(features: [String: Double], scale: Double = 10.0) -> Double {
         guard count > 0 else { return 0.5 }
         var dist: Double = 0.0
-        for (k, v) in features {
-            let m = means[k] ?? v
-            dist += abs(v - m)
+        for (key, value) in features {
+            if let slot = Self.slotIds[key] {
+                // Unobserved slots contribute nothing, as with the old
+                // dictionary that only held keys already seen
+                if everObserved[slot] { dist += abs(value - means[slot]) }
+            } else {
+                let m = overflowMeans[key] ?? value
+                dist += abs(value - m)
+            }
         }
         let s = 1.0 / (1.0 + dist / max(1.0, scale))
         return min(1.0, max(0.0, s))
     }
+
+    /// Running variance estimate for a canonical feature (nil before two
+    /// observations or for unknown keys)
+    public func variance(for key: String) -> Double? {
+        guard count > 1, let slot = Self.slotIds[key], everObserved[slot] else { return nil }
+        return m2[slot] / Double(count - 1)
+    }
 }
@@ -1,15 +1,23 @@
 import Foundation
+import os
 
 /// Token bucket rate limiter for enterprise DoS protection
+///
+/// The admission decision is the first shared point every request crosses, so
+/// it avoids both the dispatch-queue round-trip and the `Date()` call of the
+/// original implementation: state is a (tokens, last-refill) pair guarded by
+/// an uncontended unfair lock, and refill arithmetic runs on the monotonic
+/// uptime clock. An `allow()` call is one clock read, a handful of arithmetic
+/// ops, and a lock that compiles down to a compare-and-swap when uncontended.
 @available(iOS 15.0, macOS 12.0, *)
 public final class RateLimiter: @unchecked Sendable {
-    
-    private let queue = DispatchQueue(label: "com.novinintelligence.ratelimiter")
+
+    private let lock: UnsafeMutablePointer<os_unfair_lock_s>
     private var tokens: Double
     private let maxTokens: Double
     private let refillRate: Double  // tokens per second
-    private var lastRefill: Date
-    
+    private var lastRefillNs: UInt64
+
     /// Initialize rate limiter
     /// - Parameters:
     ///   - maxTokens: Maximum tokens (burst capacity)
@@ -18,45 +26,44 @@ public final class RateLimiter: @unchecked Sendable {
         self.maxTokens = maxTokens
         self.refillRate = refillRate
         self.tokens = maxTokens
-        self.lastRefill = Date()
+        self.lastRefillNs = DispatchTime.now().uptimeNanoseconds
+        self.lock = UnsafeMutablePointer<os_unfair_lock_s>.allocate(capacity: 1)
+        self.lock.initialize(to: os_unfair_lock_s())
     }
-    
+
     /// Check if request is allowed
     /// - Parameter cost: Token cost (default 1)
     /// - Returns: True if allowed, false if rate limited
     public func allow(cost: Double = 1.0) -> Bool {
-        return queue.sync {
-            // Refill tokens based on time passed
-            let now = Date()
-            let elapsed = now.timeIntervalSince(lastRefill)
-            let newTokens = elapsed * refillRate
-            tokens = min(maxTokens, tokens + newTokens)
-            lastRefill = now
-            
-            // Check if we have enough tokens
-            if tokens >= cost {
-                tokens -= cost
-                return true
-            } else {
-                return false
-            }
+        let nowNs = DispatchTime.now().uptimeNanoseconds
+        os_unfair_lock_lock(lock)
+        // Refill tokens from the monotonic clock (immune to wall-clock jumps)
+        let elapsed = Double(nowNs &- lastRefillNs) / 1e9
+        tokens = min(maxTokens, tokens + elapsed * refillRate)
+        lastRefillNs = nowNs
+
+        // Check if we have enough tokens
+        let allowed = tokens >= cost
+        if allowed {
+            tokens -= cost
         }
+        os_unfair_lock_unlock(lock)
+        return allowed
     }
-    
+
     /// Reset rate limiter (for testing)
     public func reset() {
-        queue.sync {
-            tokens = maxTokens
-            lastRefill = Date()
-        }
+        os_unfair_lock_lock(lock)
+        tokens = maxTokens
+        lastRefillNs = DispatchTime.now().uptimeNanoseconds
+        os_unfair_lock_unlock(lock)
     }
-    
+
     /// Get current token count (for monitoring)
     public func getCurrentTokens() -> Double {
-        return queue.sync { tokens }
+        os_unfair_lock_lock(lock)
+        let current = tokens
+        os_unfair_lock_unlock(lock)
+        return current
     }
 }
-
-
-
-
@@ -0,0 +1,60 @@
+import Foundation
+
+/// Typed, validated view of one security event request.
+///
+/// `InputValidator` parses the incoming JSON exactly once and this struct
+/// materializes the fields the hot path probes repeatedly (type, timestamp,
+/// metadata, location, home mode, confidence), so the assessment pipeline
+/// reads stored properties instead of re-casting `[String: Any]` values
+/// dozens of times per event. The raw dictionary is retained for consumers
+/// that still take the full request (feature extraction, rule reasoning,
+/// audit hashing).
+@available(iOS 15.0, macOS 12.0, *)
+public struct SecurityEventRequest {
+    /// Raw validated request for dictionary-based consumers
+    public let raw: [String: Any]
+
+    // Hot-path fields, decoded once
+    public let type: String?
+    public let timestamp: Double?
+    public let confidence: Double?
+    public let homeMode: String?
+    public let metadata: [String: Any]?
+    public let location: String?
+    public let metadataHomeMode: String?
+    public let motionDuration: Double?
+    public let motionEnergy: Double?
+    public let activityHint: String?
+
+    /// Decode typed fields from an already-validated request dictionary
+    init(raw: [String: Any]) {
+        self.raw = raw
+        self.type = raw["type"] as? String
+        if let t = raw["timestamp"] as? Double {
+            self.timestamp = t
+        } else if let t = raw["timestamp"] as? Int {
+            self.timestamp = Double(t)
+        } else {
+            self.timestamp = nil
+        }
+        self.confidence = raw["confidence"] as? Double
+        self.homeMode = raw["home_mode"] as? String
+        let metadata = raw["metadata"] as? [String: Any]
+        self.metadata = metadata
+        self.location = metadata?["location"] as? String
+        self.metadataHomeMode = metadata?["home_mode"] as? String
+        self.motionDuration = metadata?["duration"] as? Double
+        self.motionEnergy = metadata?["energy"] as? Double
+        self.activityHint = metadata?["activity"] as? String
+    }
+
+    /// Event timestamp, defaulting to now for events without one
+    public var eventTimestamp: Double {
+        return timestamp ?? Date().timeIntervalSince1970
+    }
+
+    /// True when the event type carries motion
+    public var isMotionEvent: Bool {
+        return type?.contains("motion") == true
+    }
+}
@@ -22,7 +22,23 @@ public struct SecurityAssessment: Codable {
     public let detailedReasoning: String?    // Full "why" explanation
     public let context: [String]?            // Contextual factors
     public let recommendation: String?       // What user should do
-    
+
+    /// Compact explanation inputs, present when lazy explanations are enabled.
+    /// Not serialized; call `renderExplanation()` to materialize text.
+    public internal(set) var explanationToken: ExplanationToken?
+
+    // The token is an in-memory handle only; coded fields are unchanged
+    private enum CodingKeys: String, CodingKey {
+        case threatLevel, confidence, processingTimeMs, reasoning, requestId, timestamp
+        case summary, detailedReasoning, context, recommendation
+    }
+
+    /// Materialize the human-readable explanation on demand (lazy mode).
+    /// Returns nil when no token was attached (eager mode or decoded value).
+    public func renderExplanation() -> ExplanationToken.Rendered? {
+        return explanationToken?.render()
+    }
+
     public init(
         threatLevel: ThreatLevel,
         confidence: Double,
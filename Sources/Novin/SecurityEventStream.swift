@@ -0,0 +1,156 @@
+import Foundation
+
+/// Streaming ingestion surface for continuous sensor feeds.
+///
+/// Producers `send` typed events — parsed dictionaries or raw JSON bytes —
+/// which are validated immediately (malformed input fails at the producer,
+/// not deep in the pipeline) and queued into a bounded buffer. When the
+/// buffer is full, `send` suspends until the consumer drains a slot, so a
+/// sensor storm queues against backpressure instead of dropping events or
+/// ballooning memory. Nothing on this path re-serializes to JSON.
+///
+/// Results arrive on `assessments` in arrival order:
+///
+///     let stream = NovinIntelligence.shared.openEventStream()
+///     Task { for try await assessment in stream.assessments { ... } }
+///     try await stream.send(["type": "motion", ...])
+///     stream.finish()
+@available(iOS 15.0, macOS 12.0, *)
+public final class SecurityEventStream: @unchecked Sendable {
+
+    private let sdk: NovinIntelligence
+    private let capacity: Int
+
+    // Bounded channel state. Invariants: a pending read exists only while the
+    // buffer is empty; blocked sends exist only while the buffer is full.
+    private let lock = NSLock()
+    private var buffer: [SecurityEventRequest] = []
+    private var blockedSends: [CheckedContinuation<Void, Never>] = []
+    private var pendingRead: CheckedContinuation<SecurityEventRequest?, Never>?
+    private var finished = false
+
+    /// Assessments for streamed events, in arrival order. Finishes after
+    /// `finish()` once the buffer drains, or with the first pipeline error.
+    public let assessments: AsyncThrowingStream<SecurityAssessment, Error>
+    private var consumer: Task<Void, Never>?
+
+    internal init(sdk: NovinIntelligence, capacity: Int) {
+        self.sdk = sdk
+        self.capacity = max(1, capacity)
+
+        var streamContinuation: AsyncThrowingStream<SecurityAssessment, Error>.Continuation!
+        self.assessments = AsyncThrowingStream { streamContinuation = $0 }
+        let out = streamContinuation!
+
+        consumer = Task { [weak self] in
+            while let request = await self?.nextRequest() {
+                guard let sdk = self?.sdk else { break }
+                do {
+                    // The bounded buffer is the admission control here; the
+                    // token-bucket limiter is bypassed so storms queue
+                    // rather than throw.
+                    let assessment = try await sdk.assessValidated(request, rateLimited: false)
+                    out.yield(assessment)
+                } catch {
+                    // Tear down the channel before finishing, or producers
+                    // parked on a full buffer would hang forever on
+                    // continuations nobody will ever drain
+                    self?.closeChannel()
+                    out.finish(throwing: error)
+                    return
+                }
+            }
+            out.finish()
+        }
+    }
+
+    // MARK: - Producer API
+
+    /// Submit one event as a parsed dictionary; suspends while the buffer is
+    /// at capacity. Throws `InputValidator.ValidationError` for bad input.
+    public func send(_ event: [String: Any]) async throws {
+        try await enqueue(InputValidator.validateTypedInput(event))
+    }
+
+    /// Submit one event as raw JSON bytes (single parse, no String round-trip)
+    public func send(data: Data) async throws {
+        try await enqueue(InputValidator.validateTypedInput(data: data))
+    }
+
+    /// Signal the end of input. Buffered events still drain; `assessments`
+    /// finishes afterwards. Further sends throw.
+    public func finish() {
+        lock.lock()
+        finished = true
+        let read = pendingRead
+        pendingRead = nil
+        let sends = blockedSends
+        blockedSends.removeAll()
+        lock.unlock()
+        for send in sends { send.resume() }
+        // A pending read implies an empty buffer, so the stream is done
+        read?.resume(returning: nil)
+    }
+
+    // MARK: - Channel internals
+
+    /// Close the channel after a pipeline error: mark it finished so further
+    /// sends throw, resume every producer parked on the full buffer (they
+    /// re-check and throw), and drop buffered events — the stream has already
+    /// terminated, so nothing would ever consume them.
+    private func closeChannel() {
+        lock.lock()
+        finished = true
+        buffer.removeAll()
+        let sends = blockedSends
+        blockedSends.removeAll()
+        lock.unlock()
+        for send in sends { send.resume() }
+    }
+
+    private func enqueue(_ request: SecurityEventRequest) async throws {
+        while true {
+            lock.lock()
+            if finished {
+                lock.unlock()
+                throw NovinIntelligenceError.invalidInput("event stream is finished")
+            }
+            if let read = pendingRead {
+                // Consumer is waiting: hand the event over directly
+                pendingRead = nil
+                lock.unlock()
+                read.resume(returning: request)
+                return
+            }
+            if buffer.count < capacity {
+                buffer.append(request)
+                lock.unlock()
+                return
+            }
+            // Full: park until the consumer drains a slot, then re-check
+            await withCheckedContinuation { (parked: CheckedContinuation<Void, Never>) in
+                blockedSends.append(parked)
+                lock.unlock()
+            }
+        }
+    }
+
+    private func nextRequest() async -> SecurityEventRequest? {
+        lock.lock()
+        if !buffer.isEmpty {
+            let request = buffer.removeFirst()
+            let unparked = blockedSends.isEmpty ? nil : blockedSends.removeFirst()
+            lock.unlock()
+            unparked?.resume()
+            return request
+        }
+        if finished {
+            lock.unlock()
+            return nil
+        }
+        return await withCheckedContinuation { (read: CheckedContinuation<SecurityEventRequest?, Never>) in
+            pendingRead = read
+            lock.unlock()
+        }
+    }
+}
@@ -1,22 +1,48 @@
 import Foundation
+import os
 
 /// Enterprise AI: Privacy-safe telemetry for temporal dampening
 /// No PII, no cloud sync, on-device analytics only
+///
+/// Storage is a fixed-size ring (no element shifting on overflow) and every
+/// aggregate `getMetrics()` reports — counts, reduction/boost sums, type
+/// breakdown, hour-bucketed recency — is maintained incrementally at record
+/// time: an overwritten event's contributions are subtracted as its slot is
+/// reused, so the aggregates always describe exactly the stored window.
+/// Both `record()` and `getMetrics()` are constant-cost regardless of
+/// history size.
 public class TemporalTelemetry {
-    
-    // MARK: - Metrics
-    
-    private var dampeningEvents: [DampeningEvent] = []
+
+    // MARK: - Storage
+
     private let maxEventsStored: Int = 500
-    
+    private var ring: [DampeningEvent?]
+    private var nextSlot: Int = 0
+    private var storedCount: Int = 0
+
+    // Incremental aggregates over the stored window
+    private var dampenedCount: Int = 0
+    private var boostedCount: Int = 0
+    private var reductionSum: Double = 0
+    private var boostSum: Double = 0
+    private var typeCounts: [DampeningType: Int] = [:]
+    // Event counts bucketed by whole hours since epoch, for the 24h window
+    private var hourBuckets: [Int: Int] = [:]
+
+    private let lock: UnsafeMutablePointer<os_unfair_lock_s>
+
     // MARK: - Singleton
-    
+
     public static let shared = TemporalTelemetry()
-    private init() {}
-    
+    private init() {
+        ring = [DampeningEvent?](repeating: nil, count: maxEventsStored)
+        lock = UnsafeMutablePointer<os_unfair_lock_s>.allocate(capacity: 1)
+        lock.initialize(to: os_unfair_lock_s())
+    }
+
     // MARK: - Recording
-    
-    /// Record a dampening event
+
+    /// Record a dampening event (O(1): one ring write plus aggregate updates)
     public func record(
         eventType: String,
         originalScore: Double,
@@ -31,81 +57,105 @@ public class TemporalTelemetry {
             dampeningType: dampeningType,
             timestamp: timestamp
         )
-        
-        dampeningEvents.append(event)
-        
-        // Trim to max size
-        if dampeningEvents.count > maxEventsStored {
-            dampeningEvents.removeFirst(dampeningEvents.count - maxEventsStored)
+
+        os_unfair_lock_lock(lock)
+        // Reusing a slot evicts its event from the window: back out its
+        // contributions before adding the new one
+        if let evicted = ring[nextSlot] {
+            apply(evicted, sign: -1)
+            storedCount -= 1
+        }
+        ring[nextSlot] = event
+        nextSlot = (nextSlot + 1) % maxEventsStored
+        storedCount += 1
+        apply(event, sign: 1)
+        os_unfair_lock_unlock(lock)
+    }
+
+    /// Add (+1) or remove (-1) one event's contribution to the aggregates.
+    /// Call with the lock held.
+    private func apply(_ event: DampeningEvent, sign: Int) {
+        let s = Double(sign)
+        if event.dampenedScore < event.originalScore {
+            dampenedCount += sign
+            reductionSum += s * (event.originalScore - event.dampenedScore)
+        } else if event.dampenedScore > event.originalScore {
+            boostedCount += sign
+            boostSum += s * (event.dampenedScore - event.originalScore)
         }
+
+        typeCounts[event.dampeningType, default: 0] += sign
+        if typeCounts[event.dampeningType] == 0 { typeCounts[event.dampeningType] = nil }
+
+        let hour = Int(event.timestamp.timeIntervalSince1970 / 3600)
+        hourBuckets[hour, default: 0] += sign
+        if hourBuckets[hour] == 0 { hourBuckets[hour] = nil }
     }
-    
+
     // MARK: - Analytics
-    
-    /// Get dampening effectiveness metrics
+
+    /// Get dampening effectiveness metrics (reads the maintained aggregates;
+    /// no scan over stored events)
     public func getMetrics() -> DampeningMetrics {
-        guard !dampeningEvents.isEmpty else {
+        os_unfair_lock_lock(lock)
+        defer { os_unfair_lock_unlock(lock) }
+
+        guard storedCount > 0 else {
             return DampeningMetrics.empty
         }
-        
-        let totalEvents = dampeningEvents.count
-        let dampenedEvents = dampeningEvents.filter { $0.dampenedScore < $0.originalScore }
-        let boostedEvents = dampeningEvents.filter { $0.dampenedScore > $0.originalScore }
-        
-        let averageReduction = dampenedEvents.map { $0.originalScore - $0.dampenedScore }.reduce(0, +) / Double(max(1, dampenedEvents.count))
-        let averageBoost = boostedEvents.map { $0.dampenedScore - $0.originalScore }.reduce(0, +) / Double(max(1, boostedEvents.count))
-        
-        // Group by dampening type
-        var typeBreakdown: [DampeningType: Int] = [:]
-        for event in dampeningEvents {
-            typeBreakdown[event.dampeningType, default: 0] += 1
+
+        // Sum the hour buckets inside the window (at most ~25 live keys for
+        // steady traffic; bounded by stored events regardless)
+        let currentHour = Int(Date().timeIntervalSince1970 / 3600)
+        var recent24h = 0
+        for (hour, count) in hourBuckets where currentHour - hour < 24 {
+            recent24h += count
         }
-        
-        // Recent performance (last 24 hours)
-        let recentEvents = dampeningEvents.filter { abs($0.timestamp.timeIntervalSinceNow) < 24 * 3600 }
-        
+
+        let dampeningRatio = Double(dampenedCount) / Double(storedCount)
+        let boostRatio = Double(boostedCount) / Double(storedCount)
+        // Effectiveness: 70% dampening, 30% appropriate boosting
+        let effectiveness = min(1.0, dampeningRatio * 0.7 + (1.0 - boostRatio) * 0.3)
+
         return DampeningMetrics(
-            totalEvents: totalEvents,
-            dampenedEvents: dampenedEvents.count,
-            boostedEvents: boostedEvents.count,
-            averageReduction: averageReduction,
-            averageBoost: averageBoost,
-            typeBreakdown: typeBreakdown,
-            recentEvents24h: recentEvents.count,
-            effectiveness: calculateEffectiveness()
+            totalEvents: storedCount,
+            dampenedEvents: dampenedCount,
+            boostedEvents: boostedCount,
+            averageReduction: reductionSum / Double(max(1, dampenedCount)),
+            averageBoost: boostSum / Double(max(1, boostedCount)),
+            typeBreakdown: typeCounts,
+            recentEvents24h: recent24h,
+            effectiveness: effectiveness
         )
     }
-    
-    /// Calculate overall effectiveness score
-    private func calculateEffectiveness() -> Double {
-        // Simple heuristic: More dampening with fewer boosts = more effective
-        let metrics = getMetrics()
-        guard metrics.totalEvents > 0 else { return 0.0 }
-        
-        let dampeningRatio = Double(metrics.dampenedEvents) / Double(metrics.totalEvents)
-        let boostRatio = Double(metrics.boostedEvents) / Double(metrics.totalEvents)
-        
-        // Effectiveness: 70% dampening, 30% appropriate boosting
-        return min(1.0, dampeningRatio * 0.7 + (1.0 - boostRatio) * 0.3)
-    }
-    
+
     /// Export metrics as JSON (privacy-safe, no PII)
     public func exportMetrics() -> String? {
         let metrics = getMetrics()
         let encoder = JSONEncoder()
         encoder.outputFormatting = [.prettyPrinted, .sortedKeys]
-        
+
         guard let data = try? encoder.encode(metrics),
               let json = String(data: data, encoding: .utf8) else {
             return nil
         }
-        
+
         return json
     }
-    
+
     /// Reset telemetry (for testing)
     public func reset() {
-        dampeningEvents.removeAll()
+        os_unfair_lock_lock(lock)
+        ring = [DampeningEvent?](repeating: nil, count: maxEventsStored)
+        nextSlot = 0
+        storedCount = 0
+        dampenedCount = 0
+        boostedCount = 0
+        reductionSum = 0
+        boostSum = 0
+        typeCounts.removeAll()
+        hourBuckets.removeAll()
+        os_unfair_lock_unlock(lock)
     }
 }
 
@@ -139,7 +189,7 @@ public struct DampeningMetrics: Codable {
     public let typeBreakdown: [DampeningType: Int]
     public let recentEvents24h: Int
     public let effectiveness: Double
-    
+
     public static let empty = DampeningMetrics(
         totalEvents: 0,
         dampenedEvents: 0,
@@ -151,4 +201,3 @@ public struct DampeningMetrics: Codable {
         effectiveness: 0.0
     )
 }
-
@@ -0,0 +1,256 @@
+import Foundation
+import Novin
+
+/// Benchmark driver for the Novin assessment pipeline.
+///
+/// Runs a corpus of realistic scenario chains (delivery, prowler, pet,
+/// glass-break, night entry) through the public SDK surface and reports
+/// per-event latency percentiles, throughput, and memory growth, plus
+/// stage timings for the public components an executable target can reach
+/// (validation, zone classification, chain analysis). Output is a stable
+/// JSON document intended to be diffed across releases:
+///
+///     swift run -c release NovinBenchmarks [iterations] [--json <path>]
+@main
+struct NovinBenchmarks {
+
+    // MARK: - Scenario Corpus
+
+    struct Scenario {
+        let name: String
+        /// Ordered event chain; timestamps are offsets in seconds applied
+        /// relative to "now" at send time so chain windows behave as in
+        /// production
+        let events: [(offset: TimeInterval, json: [String: Any])]
+    }
+
+    static func event(_ type: String, location: String, confidence: Double, homeMode: String = "home", extra: [String: Any] = [:]) -> [String: Any] {
+        var metadata: [String: Any] = ["location": location]
+        for (k, v) in extra { metadata[k] = v }
+        return [
+            "type": type,
+            "confidence": confidence,
+            "home_mode": homeMode,
+            "metadata": metadata
+        ]
+    }
+
+    static let corpus: [Scenario] = [
+        Scenario(name: "package_delivery", events: [
+            (0, event("doorbell_chime", location: "front_door", confidence: 0.92)),
+            (4, event("motion", location: "front_door", confidence: 0.85, extra: ["duration": 8.0, "energy": 0.3]))
+        ]),
+        Scenario(name: "prowler", events: [
+            (0, event("motion", location: "backyard", confidence: 0.80)),
+            (12, event("motion", location: "side_yard", confidence: 0.78)),
+            (25, event("motion", location: "front_yard", confidence: 0.82))
+        ]),
+        Scenario(name: "pet_motion", events: [
+            (0, event("pet", location: "living_room", confidence: 0.88, extra: ["duration": 3.0, "energy": 0.1]))
+        ]),
+        Scenario(name: "glass_break_chain", events: [
+            (0, event("glassbreak", location: "back_door", confidence: 0.95, homeMode: "away")),
+            (6, event("motion", location: "living_room", confidence: 0.90, homeMode: "away"))
+        ]),
+        Scenario(name: "night_entry", events: [
+            (0, event("door", location: "front_door", confidence: 0.90, homeMode: "night")),
+            (8, event("motion", location: "hallway", confidence: 0.85, homeMode: "night"))
+        ])
+    ]
+
+    // MARK: - Measurement
+
+    struct LatencyStats {
+        let samples: Int
+        let p50Ms: Double
+        let p95Ms: Double
+        let p99Ms: Double
+        let maxMs: Double
+        let throughputPerSec: Double
+
+        init(latenciesSeconds: [Double], wallSeconds: Double) {
+            let sorted = latenciesSeconds.sorted()
+            func pct(_ p: Double) -> Double {
+                guard !sorted.isEmpty else { return 0 }
+                let idx = min(sorted.count - 1, Int(Double(sorted.count) * p))
+                return sorted[idx] * 1000
+            }
+            self.samples = sorted.count
+            self.p50Ms = pct(0.50)
+            self.p95Ms = pct(0.95)
+            self.p99Ms = pct(0.99)
+            self.maxMs = (sorted.last ?? 0) * 1000
+            self.throughputPerSec = wallSeconds > 0 ? Double(sorted.count) / wallSeconds : 0
+        }
+
+        var json: [String: Any] {
+            return [
+                "samples": samples,
+                "p50_ms": rounded(p50Ms),
+                "p95_ms": rounded(p95Ms),
+                "p99_ms": rounded(p99Ms),
+                "max_ms": rounded(maxMs),
+                "throughput_per_sec": rounded(throughputPerSec)
+            ]
+        }
+    }
+
+    static func rounded(_ v: Double) -> Double {
+        return (v * 1000).rounded() / 1000
+    }
+
+    /// Resident memory in bytes (0 where task_info is unavailable)
+    static func residentBytes() -> UInt64 {
+        #if canImport(Darwin)
+        var info = mach_task_basic_info()
+        var count = mach_msg_type_number_t(MemoryLayout<mach_task_basic_info>.size / MemoryLayout<natural_t>.size)
+        let result = withUnsafeMutablePointer(to: &info) {
+            $0.withMemoryRebound(to: integer_t.self, capacity: Int(count)) {
+                task_info(mach_task_self_, task_flavor_t(MACH_TASK_BASIC_INFO), $0, &count)
+            }
+        }
+        return result == KERN_SUCCESS ? info.resident_size : 0
+        #else
+        return 0
+        #endif
+    }
+
+    // MARK: - Benchmarks
+
+    static func benchmarkAssess(iterations: Int) async throws -> [String: Any] {
+        let sdk = NovinIntelligence.shared
+        var latencies: [Double] = []
+        var perScenario: [String: [Double]] = [:]
+        latencies.reserveCapacity(iterations * 2)
+
+        // Warmup: one pass over the corpus to populate caches and rule state
+        for scenario in corpus {
+            for (offset, var payload) in scenario.events {
+                payload["timestamp"] = Date().timeIntervalSince1970 - 60 + offset
+                let json = try jsonString(payload)
+                _ = try? await sdk.assess(requestJson: json)
+            }
+        }
+
+        let memoryBefore = residentBytes()
+        let wallStart = Date()
+        for _ in 0..<iterations {
+            // The production token bucket admits 100 events/sec; refill it so
+            // the benchmark measures pipeline cost, not admission control
+            sdk.resetRateLimiter()
+            for scenario in corpus {
+                let base = Date().timeIntervalSince1970 - 60
+                for (offset, var payload) in scenario.events {
+                    payload["timestamp"] = base + offset
+                    let json = try jsonString(payload)
+                    let start = DispatchTime.now()
+                    _ = try? await sdk.assess(requestJson: json)
+                    let elapsed = Double(DispatchTime.now().uptimeNanoseconds - start.uptimeNanoseconds) / 1e9
+                    latencies.append(elapsed)
+                    perScenario[scenario.name, default: []].append(elapsed)
+                }
+            }
+        }
+        let wall = Date().timeIntervalSince(wallStart)
+        let memoryAfter = residentBytes()
+
+        var scenarios: [String: Any] = [:]
+        for (name, values) in perScenario {
+            // Scenarios interleave inside the overall wall clock, so each one's
+            // wall time is the sum of its own latencies (as benchmarkStages does)
+            scenarios[name] = LatencyStats(latenciesSeconds: values, wallSeconds: values.reduce(0, +)).json
+        }
+        return [
+            "overall": LatencyStats(latenciesSeconds: latencies, wallSeconds: wall).json,
+            "scenarios": scenarios,
+            "resident_bytes_delta": Int64(bitPattern: memoryAfter &- memoryBefore)
+        ]
+    }
+
+    /// Stage-level timings for the public components an executable can reach
+    static func benchmarkStages(iterations: Int) throws -> [String: Any] {
+        let sampleEvent = event("motion", location: "front_door", confidence: 0.85, extra: ["duration": 8.0, "energy": 0.3])
+        let sampleJson = try jsonString(sampleEvent)
+
+        func time(_ block: () -> Void) -> Double {
+            let start = DispatchTime.now()
+            block()
+            return Double(DispatchTime.now().uptimeNanoseconds - start.uptimeNanoseconds) / 1e9
+        }
+
+        var validation: [Double] = []
+        var zone: [Double] = []
+        var chain: [Double] = []
+
+        let classifier = ZoneClassifier()
+        let analyzer = EventChainAnalyzer()
+        let locations = ["front_door", "backyard", "living_room", "garage", "front_door_camera_2"]
+
+        for i in 0..<(iterations * 10) {
+            validation.append(time { _ = try? InputValidator.validateTypedInput(sampleJson) })
+            zone.append(time { _ = classifier.classifyLocation(locations[i % locations.count]) })
+            chain.append(time {
+                _ = analyzer.analyzeChain(EventChainAnalyzer.SecurityEvent(
+                    type: i % 3 == 0 ? "doorbell_chime" : "motion",
+                    timestamp: Date(),
+                    location: locations[i % locations.count],
+                    confidence: 0.85
+                ))
+            })
+        }
+
+        return [
+            "input_validation": LatencyStats(latenciesSeconds: validation, wallSeconds: validation.reduce(0, +)).json,
+            "zone_classification": LatencyStats(latenciesSeconds: zone, wallSeconds: zone.reduce(0, +)).json,
+            "chain_analysis": LatencyStats(latenciesSeconds: chain, wallSeconds: chain.reduce(0, +)).json
+        ]
+    }
+
+    // MARK: - Output
+
+    static func jsonString(_ object: [String: Any]) throws -> String {
+        let data = try JSONSerialization.data(withJSONObject: object, options: [.sortedKeys])
+        return String(data: data, encoding: .utf8) ?? "{}"
+    }
+
+    static func main() async {
+        var iterations = 200
+        var jsonPath: String?
+        var args = Array(CommandLine.arguments.dropFirst())
+        while !args.isEmpty {
+            let arg = args.removeFirst()
+            if arg == "--json", !args.isEmpty {
+                jsonPath = args.removeFirst()
+            } else if let n = Int(arg) {
+                iterations = max(1, n)
+            }
+        }
+
+        do {
+            try await NovinIntelligence.shared.initialize()
+
+            let stages = try benchmarkStages(iterations: iterations)
+            let endToEnd = try await benchmarkAssess(iterations: iterations)
+
+            let report: [String: Any] = [
+                "sdk_version": NovinIntelligence.sdkVersion,
+                "date": ISO8601DateFormatter().string(from: Date()),
+                "iterations": iterations,
+                "end_to_end": endToEnd,
+                "stages": stages
+            ]
+            let data = try JSONSerialization.data(withJSONObject: report, options: [.sortedKeys, .prettyPrinted])
+            let output = String(data: data, encoding: .utf8) ?? "{}"
+
+            if let jsonPath = jsonPath {
+                try output.write(toFile: jsonPath, atomically: true, encoding: .utf8)
+                print("Benchmark report written to \(jsonPath)")
+            } else {
+                print(output)
+            }
+        } catch {
+            FileHandle.standardError.write(Data("Benchmark failed: \(error)\n".utf8))
+            exit(1)
+        }
+    }
+}
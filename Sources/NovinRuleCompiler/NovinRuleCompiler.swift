@@ -0,0 +1,44 @@
+import Foundation
+import Novin
+
+/// Offline compiler for rule packs.
+///
+/// Converts the authoring `rules.json` into the versioned binary `rules.pack`
+/// consumed by `ReasoningSwift.loadRules()` (see `RulePack` for the layout).
+/// Run before release builds and bundle the output next to the JSON:
+///
+///     swift run NovinRuleCompiler Sources/Novin/Rules/rules.json \
+///         Sources/Novin/Rules/rules.pack
+///
+/// The SDK falls back to parsing the JSON when no pack is bundled, so
+/// development iterations on rules.json need no recompile step.
+@main
+struct NovinRuleCompiler {
+    static func main() {
+        let args = Array(CommandLine.arguments.dropFirst())
+        guard args.count == 2 else {
+            FileHandle.standardError.write(Data("usage: NovinRuleCompiler <rules.json> <rules.pack>\n".utf8))
+            exit(2)
+        }
+        let inputPath = args[0]
+        let outputPath = args[1]
+
+        do {
+            let json = try Data(contentsOf: URL(fileURLWithPath: inputPath))
+            let pack = try RulePack.compile(fromJSON: json)
+
+            // Round-trip check: the pack must decode to the same rule set the
+            // JSON loader would produce
+            guard let decoded = RulePack.decode(pack) else {
+                FileHandle.standardError.write(Data("error: compiled pack failed to decode\n".utf8))
+                exit(1)
+            }
+
+            try pack.write(to: URL(fileURLWithPath: outputPath))
+            print("Compiled \(decoded.rules.count) rules, \(decoded.conditionNames.count) distinct conditions → \(outputPath) (\(pack.count) bytes)")
+        } catch {
+            FileHandle.standardError.write(Data("error: \(error)\n".utf8))
+            exit(1)
+        }
+    }
+}